@@ -30,9 +30,14 @@
 //
 //////////////////////////////////////////////////////////////////////////////
 
+// not thread-safe: const getters update cached values (the cached time and the time string), so each thread should use its own BasicClock
+
 #ifndef KAIROS_BASICCLOCK_HPP
 #define KAIROS_BASICCLOCK_HPP
 
+#include <string>
+#include <cstddef>
+
 namespace kairos
 {
 
@@ -46,18 +51,57 @@ public:
 		unsigned int second;
 	};
 
+	struct Date
+	{
+		long long int year;
+		unsigned int month; // 1 to 12
+		unsigned int day; // 1 to 31
+		unsigned int weekday; // 0 (Sunday) to 6 (Saturday)
+	};
+
+	struct DateTime
+	{
+		Date date;
+		Time time;
+		int utcOffsetInMinutes; // offset of the time zone that date and time are in
+	};
+
+	static const std::size_t iso8601StringSize{ 48u }; // enough for any year (sign and 20 digits) and null terminator
+
 	BasicClock();
-	Time getCurrentTime() const;
+	Time getCurrentTime() const; // all parts are from a single reading of the clock
 	const unsigned int getCurrentHour() const;
 	const unsigned int getCurrentMinute() const;
 	const unsigned int getCurrentSecond() const;
+	const char* getCurrentTimeString() const; // "HH:MM:SS" (valid until the next call)
+
+	// dates are calculated directly from the days since the epoch (proleptic Gregorian calendar)
+	// and do not use localtime/gmtime. time zone offsets are given in minutes (e.g. -300 for UTC-05:00)
+	Date getCurrentDate() const; // UTC
+	DateTime getCurrentDateTime(int utcOffsetInMinutes = 0) const;
+	DateTime getDateTime(long long int secondsSinceEpoch, int utcOffsetInMinutes = 0) const; // local time is clamped to the range of long long int
+	void getDateTimes(const long long int* secondsSinceEpoch, std::size_t numberOfTimes, DateTime* dateTimes, int utcOffsetInMinutes = 0) const; // converts many times at once
+	std::size_t formatIso8601(const DateTime& dateTime, char* string) const; // writes "YYYY-MM-DDTHH:MM:SS+HH:MM" (or "Z" for UTC) and null terminator (string must have space for iso8601StringSize chars; years can have up to 20 digits). returns length
+	std::string getIso8601(const DateTime& dateTime) const;
+
+	void setCaching(bool isCaching); // when caching, time is only recalculated when the (coarse, one second) system time changes
+	bool isCaching() const;
 
 private:
 	const unsigned long long int m_secondsInOneMinute{ 60 };
 	const unsigned long long int m_secondsInOneHour{ 3600 };
 	const unsigned long long int m_secondsInOneDay{ 86400 };
 
+	bool m_isCaching;
+	mutable long long int m_cachedTimePointInSeconds;
+	mutable Time m_cachedTime;
+	mutable char m_cachedTimeString[9];
+
 	const unsigned long long int priv_getCurrentTimePointInSeconds() const;
+	Time priv_getTimeFromTimePointInSeconds(unsigned long long int timePointInSeconds) const;
+	const Time& priv_getCachedTime() const;
+	void priv_formatTime(const Time& time, char* string) const;
+	Date priv_getDateFromDaysSinceEpoch(long long int daysSinceEpoch) const;
 };
 
 } // namespace kairos
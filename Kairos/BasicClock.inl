@@ -36,6 +36,8 @@
 #include "BasicClock.hpp"
 
 #include <chrono>
+#include <ctime>
+#include <limits>
 
 namespace kairos
 {
@@ -44,29 +46,164 @@ inline BasicClock::BasicClock()
 	: m_secondsInOneMinute(60)
 	, m_secondsInOneHour(3600)
 	, m_secondsInOneDay(86400)
+	, m_isCaching(false)
+	, m_cachedTimePointInSeconds(-1)
+	, m_cachedTime{ 0u, 0u, 0u }
+	, m_cachedTimeString{ '0', '0', ':', '0', '0', ':', '0', '0', '\0' }
 {
 }
 
 inline BasicClock::Time BasicClock::getCurrentTime() const
 {
-	return{ getCurrentHour(), getCurrentMinute(), getCurrentSecond() };
+	if (m_isCaching)
+		return priv_getCachedTime();
+	return priv_getTimeFromTimePointInSeconds(priv_getCurrentTimePointInSeconds());
 }
 
 inline const unsigned int BasicClock::getCurrentHour() const
 {
+	if (m_isCaching)
+		return priv_getCachedTime().hour;
 	return static_cast<unsigned int>(priv_getCurrentTimePointInSeconds() % m_secondsInOneDay / m_secondsInOneHour);
 }
 
 inline const unsigned int BasicClock::getCurrentMinute() const
 {
+	if (m_isCaching)
+		return priv_getCachedTime().minute;
 	return static_cast<unsigned int>(priv_getCurrentTimePointInSeconds() % m_secondsInOneHour / m_secondsInOneMinute);
 }
 
 inline const unsigned int BasicClock::getCurrentSecond() const
 {
+	if (m_isCaching)
+		return priv_getCachedTime().second;
 	return static_cast<unsigned int>(priv_getCurrentTimePointInSeconds() % m_secondsInOneMinute);
 }
 
+inline const char* BasicClock::getCurrentTimeString() const
+{
+	if (m_isCaching)
+		priv_getCachedTime(); // string is formatted when the cache is refreshed
+	else
+		priv_formatTime(getCurrentTime(), m_cachedTimeString);
+	return m_cachedTimeString;
+}
+
+inline BasicClock::Date BasicClock::getCurrentDate() const
+{
+	return getCurrentDateTime().date;
+}
+
+inline BasicClock::DateTime BasicClock::getCurrentDateTime(const int utcOffsetInMinutes) const
+{
+	return getDateTime(static_cast<long long int>(priv_getCurrentTimePointInSeconds()), utcOffsetInMinutes);
+}
+
+inline BasicClock::DateTime BasicClock::getDateTime(const long long int secondsSinceEpoch, const int utcOffsetInMinutes) const
+{
+	const long long int secondsInOneDay{ static_cast<long long int>(m_secondsInOneDay) };
+	const long long int offsetInSeconds{ utcOffsetInMinutes * 60ll };
+	long long int localSeconds{ secondsSinceEpoch };
+	if ((offsetInSeconds > 0ll) && (localSeconds > std::numeric_limits<long long int>::max() - offsetInSeconds))
+		localSeconds = std::numeric_limits<long long int>::max();
+	else if ((offsetInSeconds < 0ll) && (localSeconds < std::numeric_limits<long long int>::min() - offsetInSeconds))
+		localSeconds = std::numeric_limits<long long int>::min();
+	else
+		localSeconds += offsetInSeconds;
+
+	// floor division so that times before the epoch are in the previous day (remainder is used so nothing can overflow)
+	long long int days{ localSeconds / secondsInOneDay };
+	long long int secondOfDay{ localSeconds % secondsInOneDay };
+	if (secondOfDay < 0ll)
+	{
+		--days;
+		secondOfDay += secondsInOneDay;
+	}
+
+	DateTime dateTime;
+	dateTime.date = priv_getDateFromDaysSinceEpoch(days);
+	dateTime.time = priv_getTimeFromTimePointInSeconds(static_cast<unsigned long long int>(secondOfDay));
+	dateTime.utcOffsetInMinutes = utcOffsetInMinutes;
+	return dateTime;
+}
+
+inline void BasicClock::getDateTimes(const long long int* secondsSinceEpoch, const std::size_t numberOfTimes, DateTime* dateTimes, const int utcOffsetInMinutes) const
+{
+	for (std::size_t i{ 0u }; i < numberOfTimes; ++i)
+		dateTimes[i] = getDateTime(secondsSinceEpoch[i], utcOffsetInMinutes);
+}
+
+inline std::size_t BasicClock::formatIso8601(const DateTime& dateTime, char* string) const
+{
+	std::size_t length{ 0u };
+
+	// year has at least 4 digits (and a sign if negative)
+	// (negated as unsigned so that even the lowest long long int is valid)
+	unsigned long long int year{ static_cast<unsigned long long int>(dateTime.date.year) };
+	if (dateTime.date.year < 0ll)
+	{
+		string[length++] = '-';
+		year = 0ull - year;
+	}
+	char yearDigits[20];
+	std::size_t numberOfYearDigits{ 0u };
+	do
+	{
+		yearDigits[numberOfYearDigits++] = static_cast<char>('0' + year % 10ull);
+		year /= 10ull;
+	} while ((year > 0ull) || (numberOfYearDigits < 4u));
+	while (numberOfYearDigits > 0u)
+		string[length++] = yearDigits[--numberOfYearDigits];
+
+	string[length++] = '-';
+	string[length++] = static_cast<char>('0' + dateTime.date.month / 10u);
+	string[length++] = static_cast<char>('0' + dateTime.date.month % 10u);
+	string[length++] = '-';
+	string[length++] = static_cast<char>('0' + dateTime.date.day / 10u);
+	string[length++] = static_cast<char>('0' + dateTime.date.day % 10u);
+	string[length++] = 'T';
+	priv_formatTime(dateTime.time, string + length);
+	length += 8u;
+
+	if (dateTime.utcOffsetInMinutes == 0)
+		string[length++] = 'Z';
+	else
+	{
+		const unsigned int offset{ static_cast<unsigned int>(dateTime.utcOffsetInMinutes < 0 ? -dateTime.utcOffsetInMinutes : dateTime.utcOffsetInMinutes) };
+		string[length++] = (dateTime.utcOffsetInMinutes < 0) ? '-' : '+';
+		string[length++] = static_cast<char>('0' + offset / 600u % 10u);
+		string[length++] = static_cast<char>('0' + offset / 60u % 10u);
+		string[length++] = ':';
+		string[length++] = static_cast<char>('0' + offset % 60u / 10u);
+		string[length++] = static_cast<char>('0' + offset % 10u);
+	}
+	string[length] = '\0';
+	return length;
+}
+
+inline std::string BasicClock::getIso8601(const DateTime& dateTime) const
+{
+	char string[iso8601StringSize];
+	const std::size_t length{ formatIso8601(dateTime, string) };
+	return std::string(string, length);
+}
+
+inline void BasicClock::setCaching(const bool isCaching)
+{
+	m_isCaching = isCaching;
+	m_cachedTimePointInSeconds = -1; // forces a refresh
+}
+
+inline bool BasicClock::isCaching() const
+{
+	return m_isCaching;
+}
+
+
+
+// PRIVATE
+
 inline const unsigned long long int BasicClock::priv_getCurrentTimePointInSeconds() const
 {
 	using std::chrono::system_clock;
@@ -75,5 +212,58 @@ inline const unsigned long long int BasicClock::priv_getCurrentTimePointInSecond
 	return duration.count() * system_clock::period::num / system_clock::period::den;
 }
 
+inline BasicClock::Time BasicClock::priv_getTimeFromTimePointInSeconds(const unsigned long long int timePointInSeconds) const
+{
+	return{
+		static_cast<unsigned int>(timePointInSeconds % m_secondsInOneDay / m_secondsInOneHour),
+		static_cast<unsigned int>(timePointInSeconds % m_secondsInOneHour / m_secondsInOneMinute),
+		static_cast<unsigned int>(timePointInSeconds % m_secondsInOneMinute) };
+}
+
+inline const BasicClock::Time& BasicClock::priv_getCachedTime() const
+{
+	// std::time only has a resolution of one second so is usually cheaper than a full clock reading
+	const long long int timePointInSeconds{ static_cast<long long int>(std::time(nullptr)) };
+	if (timePointInSeconds != m_cachedTimePointInSeconds)
+	{
+		m_cachedTimePointInSeconds = timePointInSeconds;
+		m_cachedTime = priv_getTimeFromTimePointInSeconds(static_cast<unsigned long long int>(timePointInSeconds));
+		priv_formatTime(m_cachedTime, m_cachedTimeString);
+	}
+	return m_cachedTime;
+}
+
+inline void BasicClock::priv_formatTime(const Time& time, char* string) const
+{
+	string[0] = static_cast<char>('0' + time.hour / 10u);
+	string[1] = static_cast<char>('0' + time.hour % 10u);
+	string[2] = ':';
+	string[3] = static_cast<char>('0' + time.minute / 10u);
+	string[4] = static_cast<char>('0' + time.minute % 10u);
+	string[5] = ':';
+	string[6] = static_cast<char>('0' + time.second / 10u);
+	string[7] = static_cast<char>('0' + time.second % 10u);
+	string[8] = '\0';
+}
+
+inline BasicClock::Date BasicClock::priv_getDateFromDaysSinceEpoch(const long long int daysSinceEpoch) const
+{
+	// civil from days (Howard Hinnant's algorithm): years are split into 400-year eras and each year starts on 1st March
+	const long long int days{ daysSinceEpoch + 719468ll }; // days since 0000-03-01
+	const long long int era{ (days >= 0ll ? days : days - 146096ll) / 146097ll };
+	const long long int dayOfEra{ days - era * 146097ll }; // 0 to 146096
+	const long long int yearOfEra{ (dayOfEra - dayOfEra / 1460ll + dayOfEra / 36524ll - dayOfEra / 146096ll) / 365ll }; // 0 to 399
+	const long long int dayOfYear{ dayOfEra - (365ll * yearOfEra + yearOfEra / 4ll - yearOfEra / 100ll) }; // 0 to 365
+	const long long int monthFromMarch{ (5ll * dayOfYear + 2ll) / 153ll }; // 0 to 11
+	const long long int month{ monthFromMarch < 10ll ? monthFromMarch + 3ll : monthFromMarch - 9ll };
+
+	Date date;
+	date.year = yearOfEra + era * 400ll + (month <= 2ll ? 1ll : 0ll);
+	date.month = static_cast<unsigned int>(month);
+	date.day = static_cast<unsigned int>(dayOfYear - (153ll * monthFromMarch + 2ll) / 5ll + 1ll);
+	date.weekday = static_cast<unsigned int>(daysSinceEpoch >= -4ll ? (daysSinceEpoch + 4ll) % 7ll : (daysSinceEpoch + 5ll) % 7ll + 6ll); // 1970-01-01 was a Thursday
+	return date;
+}
+
 } // namespace kairos
 #endif // KAIROS_BASICCLOCK_INL
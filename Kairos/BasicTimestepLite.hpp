@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Basic Timestep Lite
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// TimestepLite with its number type and step direction chosen at compile time
+
+// T can be any number type that supports copying, +=, -=, comparison and construction from 0
+// (e.g. float, double, long long int for integer ticks or a fixed-point type).
+// StaticTimestepLite also has its step fixed at compile time (as a std::ratio, in units of T).
+
+#ifndef KAIROS_BASICTIMESTEPLITE_HPP
+#define KAIROS_BASICTIMESTEPLITE_HPP
+
+#include <ratio>
+#include <type_traits>
+
+namespace kairos
+{
+
+enum class TimestepDirection
+{
+	Forward, // positive steps
+	Backward // negative steps
+};
+
+namespace priv
+{
+
+// whether a static step is non-zero in T. only arithmetic types are known to have constexpr division so other types (e.g. FixedAbsorel) only check the ratio
+template <typename T, typename Ratio, bool IsArithmetic = std::is_arithmetic<T>::value>
+struct IsStaticStepNonZero
+{
+	static constexpr bool value{ T(Ratio::num) / T(Ratio::den) != T(0) };
+};
+template <typename T, typename Ratio>
+struct IsStaticStepNonZero<T, Ratio, false>
+{
+	static constexpr bool value{ Ratio::num != 0 };
+};
+
+} // namespace priv
+
+template <typename T, TimestepDirection Direction = TimestepDirection::Forward>
+class BasicTimestepLite
+{
+public:
+	constexpr BasicTimestepLite(); // step is 0.01 in the timestep's direction (1 for types in which 0.01 is zero, e.g. integral types)
+	constexpr explicit BasicTimestepLite(T step); // a step that is not in the timestep's direction (including zero) is replaced by the default step
+	void update(T frameTime);
+	bool isTimeToIntegrate();
+
+	void setStep(T step); // a step that is not in the timestep's direction (including zero) is ignored
+	constexpr T getStep() const;
+	T getOverall() const;
+
+private:
+	T m_step;
+	T m_accumulator;
+	T m_overall;
+
+	static constexpr bool priv_isInDirection(T step);
+	static constexpr T priv_getDefaultStep();
+};
+
+template <typename T, typename Ratio, TimestepDirection Direction = TimestepDirection::Forward>
+class StaticTimestepLite
+{
+	static_assert((Direction == TimestepDirection::Forward) ? (Ratio::num > 0) : (Ratio::num < 0), "Step must be in the timestep's direction");
+	static_assert(priv::IsStaticStepNonZero<T, Ratio>::value, "Step must not be zero in T (e.g. a fractional ratio with an integral T)");
+
+public:
+	constexpr StaticTimestepLite();
+	void update(T frameTime);
+	bool isTimeToIntegrate();
+
+	static constexpr T getStep();
+	T getOverall() const;
+
+private:
+	T m_accumulator;
+	T m_overall;
+};
+
+} // namespace kairos
+
+#include "BasicTimestepLite.inl"
+#endif // KAIROS_BASICTIMESTEPLITE_HPP
@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Basic Timestep Lite
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_BASICTIMESTEPLITE_INL
+#define KAIROS_BASICTIMESTEPLITE_INL
+
+#include "BasicTimestepLite.hpp"
+
+namespace kairos
+{
+
+template <typename T, TimestepDirection Direction>
+constexpr BasicTimestepLite<T, Direction>::BasicTimestepLite()
+	: m_step(priv_getDefaultStep())
+	, m_accumulator(0)
+	, m_overall(0)
+{
+}
+
+template <typename T, TimestepDirection Direction>
+constexpr BasicTimestepLite<T, Direction>::BasicTimestepLite(const T step)
+	: m_step(priv_isInDirection(step) ? step : priv_getDefaultStep())
+	, m_accumulator(0)
+	, m_overall(0)
+{
+}
+
+template <typename T, TimestepDirection Direction>
+inline void BasicTimestepLite<T, Direction>::update(const T frameTime)
+{
+	m_accumulator += frameTime;
+}
+
+template <typename T, TimestepDirection Direction>
+inline bool BasicTimestepLite<T, Direction>::isTimeToIntegrate()
+{
+	// step is always in the timestep's direction (see setStep) and direction is a compile-time constant so this is a single comparison
+	const bool isStepAccumulated{ (Direction == TimestepDirection::Forward) ? (m_accumulator >= m_step) : (m_accumulator <= m_step) };
+	if (isStepAccumulated)
+	{
+		m_accumulator -= m_step;
+		m_overall += m_step;
+	}
+	return isStepAccumulated;
+}
+
+template <typename T, TimestepDirection Direction>
+inline void BasicTimestepLite<T, Direction>::setStep(const T step)
+{
+	if (priv_isInDirection(step))
+		m_step = step;
+}
+
+template <typename T, TimestepDirection Direction>
+constexpr T BasicTimestepLite<T, Direction>::getStep() const
+{
+	return m_step;
+}
+
+template <typename T, TimestepDirection Direction>
+inline T BasicTimestepLite<T, Direction>::getOverall() const
+{
+	const bool isPastFirstStep{ (Direction == TimestepDirection::Forward) ? (m_overall > m_step) : (m_overall < m_step) };
+	if (!isPastFirstStep)
+		return T(0);
+	T overall{ m_overall };
+	overall -= m_step;
+	return overall;
+}
+
+
+
+template <typename T, typename Ratio, TimestepDirection Direction>
+constexpr StaticTimestepLite<T, Ratio, Direction>::StaticTimestepLite()
+	: m_accumulator(0)
+	, m_overall(0)
+{
+}
+
+template <typename T, typename Ratio, TimestepDirection Direction>
+inline void StaticTimestepLite<T, Ratio, Direction>::update(const T frameTime)
+{
+	m_accumulator += frameTime;
+}
+
+template <typename T, typename Ratio, TimestepDirection Direction>
+inline bool StaticTimestepLite<T, Ratio, Direction>::isTimeToIntegrate()
+{
+	const bool isStepAccumulated{ (Direction == TimestepDirection::Forward) ? (m_accumulator >= getStep()) : (m_accumulator <= getStep()) };
+	if (isStepAccumulated)
+	{
+		m_accumulator -= getStep();
+		m_overall += getStep();
+	}
+	return isStepAccumulated;
+}
+
+template <typename T, typename Ratio, TimestepDirection Direction>
+constexpr T StaticTimestepLite<T, Ratio, Direction>::getStep()
+{
+	return T(Ratio::num) / Ratio::den; // (divided by the integral denominator so that types without division by T, e.g. FixedAbsorel, can be used)
+}
+
+template <typename T, typename Ratio, TimestepDirection Direction>
+inline T StaticTimestepLite<T, Ratio, Direction>::getOverall() const
+{
+	const bool isPastFirstStep{ (Direction == TimestepDirection::Forward) ? (m_overall > getStep()) : (m_overall < getStep()) };
+	if (!isPastFirstStep)
+		return T(0);
+	T overall{ m_overall };
+	overall -= getStep();
+	return overall;
+}
+
+
+
+// PRIVATE
+
+template <typename T, TimestepDirection Direction>
+constexpr bool BasicTimestepLite<T, Direction>::priv_isInDirection(const T step)
+{
+	return (Direction == TimestepDirection::Forward) ? (step > T(0)) : (step < T(0));
+}
+
+template <typename T, TimestepDirection Direction>
+constexpr T BasicTimestepLite<T, Direction>::priv_getDefaultStep()
+{
+	return (Direction == TimestepDirection::Forward)
+		? ((T(0.01) > T(0)) ? T(0.01) : T(1))
+		: ((T(-0.01) < T(0)) ? T(-0.01) : T(-1));
+}
+
+} // namespace kairos
+#endif // KAIROS_BASICTIMESTEPLITE_INL
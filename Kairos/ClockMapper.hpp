@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Clock Mapper
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// WARNING: C++11 or later required (uses <chrono>)
+
+// Maps steady (monotonic) clock times to wall clock (system) times
+
+// events can be stamped cheaply with now() (a steady clock reading) and converted to wall clock time later.
+// the mapping is updated from samples of both clocks; small differences are slewed (removed gradually by
+// adjusting the rate) so the mapping never jumps backwards, and large differences (e.g. the system clock
+// being set) are stepped.
+
+// previous mappings are kept (one per sample, up to the history length) so that older steady times are converted with
+// the mapping that was in use at that time instead of the current (slewed) rate.
+// times older than the history are converted with the oldest mapping kept.
+
+// not thread-safe: sample()/update() must not be called at the same time as other functions
+
+#ifndef KAIROS_CLOCKMAPPER_HPP
+#define KAIROS_CLOCKMAPPER_HPP
+
+#include "Duration.hpp"
+
+#include <cstddef>
+#include <deque>
+
+namespace kairos
+{
+
+class ClockMapper
+{
+public:
+	ClockMapper(); // takes the first sample
+	static Duration now(); // steady clock time (since the steady clock's epoch)
+	Duration getWallTime(Duration steadyTime) const; // system clock time (since the system clock's epoch) of a steady clock time
+	Duration getCurrentWallTime() const;
+
+	void sample(); // samples both clocks and adjusts the mapping
+	void update(); // samples if at least the resample interval has passed since the previous sample
+
+	void setResampleInterval(Duration resampleInterval);
+	Duration getResampleInterval() const;
+	void setMaxSlewRate(double maxSlewRate); // maximum adjustment to the rate (e.g. 0.0005 is 500ppm)
+	double getMaxSlewRate() const;
+	void setStepThreshold(Duration stepThreshold); // differences larger than this are stepped instead of slewed
+	Duration getStepThreshold() const;
+	double getRate() const; // current rate of wall clock time to steady clock time
+	void setHistoryLength(std::size_t numberOfMappings); // number of previous mappings kept (default is 3600: an hour with the default resample interval)
+	std::size_t getHistoryLength() const;
+
+private:
+	struct Mapping
+	{
+		long long int steadyOrigin;
+		long long int wallOrigin;
+		double rate;
+	};
+
+	long long int m_steadyOrigin;
+	long long int m_wallOrigin;
+	double m_rate;
+	double m_frequency; // estimated rate of the system clock compared to the steady clock
+	long long int m_previousSampleSteady;
+	long long int m_previousSampleWall;
+	long long int m_resampleInterval;
+	double m_maxSlewRate;
+	long long int m_stepThreshold;
+	std::deque<Mapping> m_history; // previous mappings, oldest first
+	std::size_t m_historyLength;
+
+	double priv_clampRate(double rate) const;
+	void priv_addCurrentMappingToHistory();
+};
+
+} // namespace kairos
+
+#include "ClockMapper.inl"
+#endif // KAIROS_CLOCKMAPPER_HPP
@@ -0,0 +1,199 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Clock Mapper
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_CLOCKMAPPER_INL
+#define KAIROS_CLOCKMAPPER_INL
+
+#include "ClockMapper.hpp"
+
+#include <algorithm> // for std::upper_bound
+#include <chrono>
+
+namespace kairos
+{
+
+inline ClockMapper::ClockMapper()
+	: m_steadyOrigin(0ll)
+	, m_wallOrigin(0ll)
+	, m_rate(1.0)
+	, m_frequency(1.0)
+	, m_previousSampleSteady(0ll)
+	, m_previousSampleWall(0ll)
+	, m_resampleInterval(1000000000ll)
+	, m_maxSlewRate(0.0005)
+	, m_stepThreshold(100000000ll)
+	, m_history()
+	, m_historyLength(3600u)
+{
+	sample();
+}
+
+inline Duration ClockMapper::now()
+{
+	using std::chrono::steady_clock;
+	return Duration{ static_cast<long long int>(std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now().time_since_epoch()).count()) };
+}
+
+inline Duration ClockMapper::getWallTime(const Duration steadyTime) const
+{
+	if ((steadyTime.nano >= m_steadyOrigin) || m_history.empty())
+		return Duration{ m_wallOrigin + static_cast<long long int>((steadyTime.nano - m_steadyOrigin) * m_rate) };
+
+	// latest previous mapping that started at or before the time (or the oldest mapping)
+	const std::deque<Mapping>::const_iterator next{ std::upper_bound(m_history.begin(), m_history.end(), steadyTime.nano, [](const long long int time, const Mapping& mapping) { return time < mapping.steadyOrigin; }) };
+	const Mapping& mapping((next == m_history.begin()) ? *next : *(next - 1));
+	return Duration{ mapping.wallOrigin + static_cast<long long int>((steadyTime.nano - mapping.steadyOrigin) * mapping.rate) };
+}
+
+inline Duration ClockMapper::getCurrentWallTime() const
+{
+	return getWallTime(now());
+}
+
+inline void ClockMapper::sample()
+{
+	using std::chrono::system_clock;
+
+	// system clock is read between two steady clock readings and paired with their midpoint
+	const long long int steadyBefore{ now().nano };
+	const long long int wall{ static_cast<long long int>(std::chrono::duration_cast<std::chrono::nanoseconds>(system_clock::now().time_since_epoch()).count()) };
+	const long long int steadyAfter{ now().nano };
+	const long long int steady{ steadyBefore + (steadyAfter - steadyBefore) / 2 };
+
+	const bool isFirstSample{ (m_previousSampleSteady == 0ll) && (m_previousSampleWall == 0ll) };
+	const long long int error{ wall - getWallTime(Duration{ steady }).nano };
+	if (isFirstSample || (error > m_stepThreshold) || (error < -m_stepThreshold))
+	{
+		// step
+		if (!isFirstSample)
+			priv_addCurrentMappingToHistory();
+		m_steadyOrigin = steady;
+		m_wallOrigin = wall;
+		m_rate = m_frequency;
+	}
+	else
+	{
+		// slew: continue from the current mapping and remove the error over the next interval
+		const long long int sampleInterval{ steady - m_previousSampleSteady };
+		if (sampleInterval > 0ll)
+		{
+			const double measuredFrequency{ static_cast<double>(wall - m_previousSampleWall) / sampleInterval };
+			m_frequency = priv_clampRate(m_frequency + (measuredFrequency - m_frequency) / 8.0);
+		}
+		const long long int wallOrigin{ getWallTime(Duration{ steady }).nano };
+		priv_addCurrentMappingToHistory();
+		m_wallOrigin = wallOrigin;
+		m_steadyOrigin = steady;
+		const long long int correctionInterval{ (m_resampleInterval > 0ll) ? m_resampleInterval : 1000000000ll };
+		m_rate = priv_clampRate(m_frequency + static_cast<double>(error) / correctionInterval);
+	}
+	m_previousSampleSteady = steady;
+	m_previousSampleWall = wall;
+}
+
+inline void ClockMapper::update()
+{
+	if (now().nano - m_previousSampleSteady >= m_resampleInterval)
+		sample();
+}
+
+inline void ClockMapper::setResampleInterval(const Duration resampleInterval)
+{
+	m_resampleInterval = resampleInterval.nano;
+}
+
+inline Duration ClockMapper::getResampleInterval() const
+{
+	return Duration{ m_resampleInterval };
+}
+
+inline void ClockMapper::setMaxSlewRate(const double maxSlewRate)
+{
+	m_maxSlewRate = (maxSlewRate > 0.0) ? maxSlewRate : 0.0;
+}
+
+inline double ClockMapper::getMaxSlewRate() const
+{
+	return m_maxSlewRate;
+}
+
+inline void ClockMapper::setStepThreshold(const Duration stepThreshold)
+{
+	m_stepThreshold = stepThreshold.nano;
+}
+
+inline Duration ClockMapper::getStepThreshold() const
+{
+	return Duration{ m_stepThreshold };
+}
+
+inline double ClockMapper::getRate() const
+{
+	return m_rate;
+}
+
+inline void ClockMapper::setHistoryLength(const std::size_t numberOfMappings)
+{
+	m_historyLength = numberOfMappings;
+	while (m_history.size() > m_historyLength)
+		m_history.pop_front();
+}
+
+inline std::size_t ClockMapper::getHistoryLength() const
+{
+	return m_historyLength;
+}
+
+
+
+// PRIVATE
+
+inline double ClockMapper::priv_clampRate(const double rate) const
+{
+	if (rate > 1.0 + m_maxSlewRate)
+		return 1.0 + m_maxSlewRate;
+	if (rate < 1.0 - m_maxSlewRate)
+		return 1.0 - m_maxSlewRate;
+	return rate;
+}
+
+inline void ClockMapper::priv_addCurrentMappingToHistory()
+{
+	if (m_historyLength == 0u)
+		return;
+	if (m_history.size() >= m_historyLength)
+		m_history.pop_front();
+	m_history.push_back({ m_steadyOrigin, m_wallOrigin, m_rate });
+}
+
+} // namespace kairos
+#endif // KAIROS_CLOCKMAPPER_INL
@@ -0,0 +1,80 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Deterministic Timestep
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Fixed timestep using integer nanoseconds only (no floating-point accumulation)
+
+// identical frame times always produce identical step counts and times on any machine,
+// making it suitable for lockstep simulations.
+// frame times are passed in (as with TimestepLite) so that they can be shared between peers.
+
+#ifndef KAIROS_DETERMINISTICTIMESTEP_HPP
+#define KAIROS_DETERMINISTICTIMESTEP_HPP
+
+#include "Duration.hpp"
+
+namespace kairos
+{
+
+class DeterministicTimestep
+{
+public:
+	static const unsigned int alphaFractionBits{ 16u }; // number of fraction bits in the fixed-point interpolation alpha
+
+	DeterministicTimestep();
+	void update(Duration frameTime); // adds frame time to accumulator
+	bool isTimeToIntegrate();
+	void reset(); // clears accumulated time, overall time and step count
+
+	void setStep(Duration step);
+	Duration getStep() const;
+	void setMaxAccumulation(Duration maxAccumulation); // zero means no maximum
+	Duration getMaxAccumulation() const;
+
+	unsigned long long int getStepCount() const; // number of steps processed
+	Duration getOverall() const; // exact amount of time processed (whole steps only)
+	Duration getAccumulated() const; // amount of time not yet processed
+	Duration getTime() const; // amount of time accumulated (processed and unprocessed)
+	long long int getInterpolationAlphaFixed() const; // fixed-point alpha: 0 to (1 << alphaFractionBits)
+	double getInterpolationAlpha() const;
+
+private:
+	long long int m_step;
+	long long int m_accumulator;
+	long long int m_overall;
+	long long int m_maxAccumulation;
+	unsigned long long int m_stepCount;
+};
+
+} // namespace kairos
+
+#include "DeterministicTimestep.inl"
+#endif // KAIROS_DETERMINISTICTIMESTEP_HPP
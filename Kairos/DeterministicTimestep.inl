@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Deterministic Timestep
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_DETERMINISTICTIMESTEP_INL
+#define KAIROS_DETERMINISTICTIMESTEP_INL
+
+#include "DeterministicTimestep.hpp"
+
+namespace kairos
+{
+
+inline DeterministicTimestep::DeterministicTimestep()
+	: m_step(10000000ll)
+	, m_accumulator(0ll)
+	, m_overall(0ll)
+	, m_maxAccumulation(0ll)
+	, m_stepCount(0ull)
+{
+}
+
+inline void DeterministicTimestep::update(const Duration frameTime)
+{
+	m_accumulator += frameTime.nano;
+	if (m_maxAccumulation == 0ll)
+		return;
+	if ((m_maxAccumulation > 0ll) && (m_accumulator > m_maxAccumulation))
+		m_accumulator = m_maxAccumulation;
+	else if ((m_maxAccumulation < 0ll) && (m_accumulator < m_maxAccumulation))
+		m_accumulator = m_maxAccumulation;
+}
+
+inline bool DeterministicTimestep::isTimeToIntegrate()
+{
+	if (((m_step > 0ll) && (m_accumulator >= m_step)) || ((m_step < 0ll) && (m_accumulator <= m_step)))
+	{
+		m_accumulator -= m_step;
+		m_overall += m_step;
+		++m_stepCount;
+		return true;
+	}
+	else
+		return false;
+}
+
+inline void DeterministicTimestep::reset()
+{
+	m_accumulator = 0ll;
+	m_overall = 0ll;
+	m_stepCount = 0ull;
+}
+
+inline void DeterministicTimestep::setStep(const Duration step)
+{
+	m_step = step.nano;
+	setMaxAccumulation(Duration{ m_maxAccumulation });
+}
+
+inline Duration DeterministicTimestep::getStep() const
+{
+	return Duration{ m_step };
+}
+
+inline void DeterministicTimestep::setMaxAccumulation(const Duration maxAccumulation)
+{
+	m_maxAccumulation = maxAccumulation.nano;
+	if (m_maxAccumulation == 0ll)
+		return;
+	// maximum accumulation is in the direction of the step and at least one step
+	if (m_step < 0ll)
+		m_maxAccumulation = (m_maxAccumulation > 0ll) ? -m_maxAccumulation : m_maxAccumulation;
+	else
+		m_maxAccumulation = (m_maxAccumulation < 0ll) ? -m_maxAccumulation : m_maxAccumulation;
+	if (((m_step > 0ll) && (m_maxAccumulation < m_step)) || ((m_step < 0ll) && (m_maxAccumulation > m_step)))
+		m_maxAccumulation = m_step;
+}
+
+inline Duration DeterministicTimestep::getMaxAccumulation() const
+{
+	return Duration{ m_maxAccumulation };
+}
+
+inline unsigned long long int DeterministicTimestep::getStepCount() const
+{
+	return m_stepCount;
+}
+
+inline Duration DeterministicTimestep::getOverall() const
+{
+	return Duration{ m_overall };
+}
+
+inline Duration DeterministicTimestep::getAccumulated() const
+{
+	return Duration{ m_accumulator };
+}
+
+inline Duration DeterministicTimestep::getTime() const
+{
+	return Duration{ m_overall + m_accumulator };
+}
+
+inline long long int DeterministicTimestep::getInterpolationAlphaFixed() const
+{
+	const long long int one{ 1ll << alphaFractionBits };
+	if (m_step == 0ll)
+		return one;
+	const long long int alpha{ (m_accumulator * one) / m_step }; // accumulator and step have the same sign after integration
+	if (alpha < 0ll)
+		return 0ll;
+	return (alpha < one) ? alpha : one;
+}
+
+inline double DeterministicTimestep::getInterpolationAlpha() const
+{
+	return static_cast<double>(getInterpolationAlphaFixed()) / static_cast<double>(1ll << alphaFractionBits);
+}
+
+} // namespace kairos
+#endif // KAIROS_DETERMINISTICTIMESTEP_INL
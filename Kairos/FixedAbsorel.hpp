@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Fixed Absorel
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Fixed-point alternative to Absorel
+
+// position is stored as a single signed 64-bit integer of step subdivisions (FractionBits bits of fraction per step).
+// comparisons are a single integer comparison and addition/subtraction are exact (no rounding or floor).
+// FixedAbsorel uses 32 fraction bits (32.32): a range of over 2 billion steps with a resolution of 1/4294967296 of a step.
+
+#ifndef KAIROS_FIXEDABSOREL_HPP
+#define KAIROS_FIXEDABSOREL_HPP
+
+#include "Absorel.hpp"
+
+#include <ostream>
+#include <type_traits>
+
+namespace kairos
+{
+
+template <unsigned int FractionBits = 32u>
+struct BasicFixedAbsorel
+{
+	static_assert(FractionBits < 63u, "FractionBits must leave space for the absolute part and sign");
+
+	static const long long int one{ 1ll << FractionBits }; // value of a single step
+
+	long long int value; // position in step subdivisions (steps multiplied by one)
+
+	BasicFixedAbsorel();
+	explicit BasicFixedAbsorel(const Absorel& absorel);
+	static BasicFixedAbsorel fromValue(long long int value);
+	static BasicFixedAbsorel fromSteps(double steps);
+	static BasicFixedAbsorel fromSteps(int absolute, double relative);
+
+	int getAbsolute() const; // whole steps (floored)
+	double getRelative() const; // fraction of a step (0 to 1)
+	double asSteps() const;
+	Absorel toAbsorel() const; // (a conversion operator would be hidden by Absorel's constructor from any number type)
+
+	BasicFixedAbsorel operator+(const BasicFixedAbsorel& offset) const;
+	BasicFixedAbsorel operator-(const BasicFixedAbsorel& offset) const;
+	BasicFixedAbsorel operator-() const;
+	template <typename T>
+	BasicFixedAbsorel operator*(const T& scale) const;
+	template <typename T>
+	BasicFixedAbsorel operator/(const T& divisor) const;
+	BasicFixedAbsorel& operator+=(const BasicFixedAbsorel& offset);
+	BasicFixedAbsorel& operator-=(const BasicFixedAbsorel& offset);
+	template <typename T>
+	BasicFixedAbsorel& operator*=(const T& scale);
+	template <typename T>
+	BasicFixedAbsorel& operator/=(const T& divisor);
+
+	bool operator<(const BasicFixedAbsorel& position) const;
+	bool operator>(const BasicFixedAbsorel& position) const;
+	bool operator<=(const BasicFixedAbsorel& position) const;
+	bool operator>=(const BasicFixedAbsorel& position) const;
+	bool operator==(const BasicFixedAbsorel& position) const;
+	bool operator!=(const BasicFixedAbsorel& position) const;
+
+private:
+	template <typename T>
+	static long long int priv_scale(long long int value, const T& scale, std::true_type isIntegral);
+	template <typename T>
+	static long long int priv_scale(long long int value, const T& scale, std::false_type isIntegral);
+	template <typename T>
+	static long long int priv_divide(long long int value, const T& divisor, std::true_type isIntegral);
+	template <typename T>
+	static long long int priv_divide(long long int value, const T& divisor, std::false_type isIntegral);
+};
+
+typedef BasicFixedAbsorel<32u> FixedAbsorel;
+
+template <unsigned int FractionBits>
+std::ostream& operator<<(std::ostream& out, const BasicFixedAbsorel<FractionBits>& position);
+
+} // namespace kairos
+
+#include "FixedAbsorel.inl"
+#endif // KAIROS_FIXEDABSOREL_HPP
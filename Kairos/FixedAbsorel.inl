@@ -0,0 +1,242 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Fixed Absorel
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_FIXEDABSOREL_INL
+#define KAIROS_FIXEDABSOREL_INL
+
+#include "FixedAbsorel.hpp"
+
+#include <cmath>
+
+namespace kairos
+{
+
+template <unsigned int FractionBits>
+const long long int BasicFixedAbsorel<FractionBits>::one;
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits>::BasicFixedAbsorel()
+	: value(0ll)
+{
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits>::BasicFixedAbsorel(const Absorel& absorel)
+	: value(fromSteps(absorel.absolute, absorel.relative).value)
+{
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::fromValue(const long long int value)
+{
+	BasicFixedAbsorel position;
+	position.value = value;
+	return position;
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::fromSteps(const double steps)
+{
+	return fromValue(static_cast<long long int>(std::floor(static_cast<long double>(steps) * one + 0.5L)));
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::fromSteps(const int absolute, const double relative)
+{
+	return fromValue(absolute * one + static_cast<long long int>(std::floor(static_cast<long double>(relative) * one + 0.5L)));
+}
+
+template <unsigned int FractionBits>
+inline int BasicFixedAbsorel<FractionBits>::getAbsolute() const
+{
+	const long long int fraction{ static_cast<long long int>(static_cast<unsigned long long int>(value) & static_cast<unsigned long long int>(one - 1ll)) };
+	return static_cast<int>((value - fraction) / one);
+}
+
+template <unsigned int FractionBits>
+inline double BasicFixedAbsorel<FractionBits>::getRelative() const
+{
+	const long long int fraction{ static_cast<long long int>(static_cast<unsigned long long int>(value) & static_cast<unsigned long long int>(one - 1ll)) };
+	return static_cast<double>(fraction) / one;
+}
+
+template <unsigned int FractionBits>
+inline double BasicFixedAbsorel<FractionBits>::asSteps() const
+{
+	return static_cast<double>(static_cast<long double>(value) / one);
+}
+
+template <unsigned int FractionBits>
+inline Absorel BasicFixedAbsorel<FractionBits>::toAbsorel() const
+{
+	return{ getAbsolute(), getRelative() };
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::operator+(const BasicFixedAbsorel& offset) const
+{
+	return fromValue(value + offset.value);
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::operator-(const BasicFixedAbsorel& offset) const
+{
+	return fromValue(value - offset.value);
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::operator-() const
+{
+	return fromValue(-value);
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::operator*(const T& scale) const
+{
+	return fromValue(priv_scale(value, scale, std::is_integral<T>()));
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline BasicFixedAbsorel<FractionBits> BasicFixedAbsorel<FractionBits>::operator/(const T& divisor) const
+{
+	return fromValue(priv_divide(value, divisor, std::is_integral<T>()));
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits>& BasicFixedAbsorel<FractionBits>::operator+=(const BasicFixedAbsorel& offset)
+{
+	value += offset.value;
+	return *this;
+}
+
+template <unsigned int FractionBits>
+inline BasicFixedAbsorel<FractionBits>& BasicFixedAbsorel<FractionBits>::operator-=(const BasicFixedAbsorel& offset)
+{
+	value -= offset.value;
+	return *this;
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline BasicFixedAbsorel<FractionBits>& BasicFixedAbsorel<FractionBits>::operator*=(const T& scale)
+{
+	*this = *this * scale;
+	return *this;
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline BasicFixedAbsorel<FractionBits>& BasicFixedAbsorel<FractionBits>::operator/=(const T& divisor)
+{
+	*this = *this / divisor;
+	return *this;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator<(const BasicFixedAbsorel& position) const
+{
+	return value < position.value;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator>(const BasicFixedAbsorel& position) const
+{
+	return value > position.value;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator<=(const BasicFixedAbsorel& position) const
+{
+	return value <= position.value;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator>=(const BasicFixedAbsorel& position) const
+{
+	return value >= position.value;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator==(const BasicFixedAbsorel& position) const
+{
+	return value == position.value;
+}
+
+template <unsigned int FractionBits>
+inline bool BasicFixedAbsorel<FractionBits>::operator!=(const BasicFixedAbsorel& position) const
+{
+	return value != position.value;
+}
+
+template <unsigned int FractionBits>
+inline std::ostream& operator<<(std::ostream& out, const BasicFixedAbsorel<FractionBits>& position)
+{
+	out << position.asSteps();
+	return out;
+}
+
+
+
+// PRIVATE
+
+template <unsigned int FractionBits>
+template <typename T>
+inline long long int BasicFixedAbsorel<FractionBits>::priv_scale(const long long int value, const T& scale, std::true_type)
+{
+	return value * static_cast<long long int>(scale);
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline long long int BasicFixedAbsorel<FractionBits>::priv_scale(const long long int value, const T& scale, std::false_type)
+{
+	return static_cast<long long int>(std::floor(static_cast<long double>(value) * scale + 0.5L));
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline long long int BasicFixedAbsorel<FractionBits>::priv_divide(const long long int value, const T& divisor, std::true_type)
+{
+	return value / static_cast<long long int>(divisor);
+}
+
+template <unsigned int FractionBits>
+template <typename T>
+inline long long int BasicFixedAbsorel<FractionBits>::priv_divide(const long long int value, const T& divisor, std::false_type)
+{
+	return static_cast<long long int>(std::floor(static_cast<long double>(value) / divisor + 0.5L));
+}
+
+} // namespace kairos
+#endif // KAIROS_FIXEDABSOREL_INL
@@ -0,0 +1,76 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Frame Limiter
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// WARNING: C++11 or later required (uses <chrono> and <thread>)
+
+// Waits until the start of the next frame using a hybrid of sleeping and spinning.
+// most of the wait is slept; the final part (the expected sleep overshoot plus the spin duration, but never more than half of the wait) is spun.
+// the sleep overshoot is measured on every sleep and the estimate adapts to the scheduler.
+
+#ifndef KAIROS_FRAMELIMITER_HPP
+#define KAIROS_FRAMELIMITER_HPP
+
+#include "Duration.hpp"
+#include "Timestep.hpp"
+
+#include <chrono>
+
+namespace kairos
+{
+
+class FrameLimiter
+{
+public:
+	FrameLimiter();
+	void setFramePeriod(Duration framePeriod); // target time between frame starts (zero disables waiting in wait())
+	Duration getFramePeriod() const;
+	void setSpinDuration(Duration spinDuration); // time always spun (not slept) before a deadline, in addition to the estimated overshoot
+	Duration getSpinDuration() const;
+	Duration getEstimatedOvershoot() const; // current estimate of how late a sleep wakes up
+	Duration wait(); // waits until one frame period after the previous frame start. returns time waited
+	Duration waitFor(Duration time); // waits for the given amount of time. returns time waited
+	Duration waitForNextUpdate(const Timestep& timestep); // waits until the timestep will require an update (or one frame period, or 10 milliseconds if there is none, when no update is pending). returns time waited
+	void reset(); // next frame period is counted from now
+
+private:
+	std::chrono::steady_clock::time_point m_nextFrameStart;
+	Duration m_framePeriod;
+	Duration m_spinDuration;
+	long long int m_overshootEstimate; // nanoseconds
+
+	void priv_waitUntil(std::chrono::steady_clock::time_point deadline);
+};
+
+} // namespace kairos
+
+#include "FrameLimiter.inl"
+#endif // KAIROS_FRAMELIMITER_HPP
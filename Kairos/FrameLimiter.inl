@@ -0,0 +1,153 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Frame Limiter
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_FRAMELIMITER_INL
+#define KAIROS_FRAMELIMITER_INL
+
+#include "FrameLimiter.hpp"
+
+#include <thread>
+
+namespace kairos
+{
+
+inline FrameLimiter::FrameLimiter()
+	: m_nextFrameStart(std::chrono::steady_clock::now())
+	, m_framePeriod(0ll)
+	, m_spinDuration(100000ll)
+	, m_overshootEstimate(1000000ll)
+{
+}
+
+inline void FrameLimiter::setFramePeriod(const Duration framePeriod)
+{
+	m_framePeriod = framePeriod;
+}
+
+inline Duration FrameLimiter::getFramePeriod() const
+{
+	return m_framePeriod;
+}
+
+inline void FrameLimiter::setSpinDuration(const Duration spinDuration)
+{
+	m_spinDuration = spinDuration;
+}
+
+inline Duration FrameLimiter::getSpinDuration() const
+{
+	return m_spinDuration;
+}
+
+inline Duration FrameLimiter::getEstimatedOvershoot() const
+{
+	return Duration{ m_overshootEstimate };
+}
+
+inline Duration FrameLimiter::wait()
+{
+	const std::chrono::steady_clock::time_point startTime{ std::chrono::steady_clock::now() };
+	if (m_framePeriod.nano <= 0ll)
+	{
+		m_nextFrameStart = startTime;
+		return Duration{ 0ll };
+	}
+
+	const std::chrono::nanoseconds framePeriod{ m_framePeriod.nano };
+	if (startTime - m_nextFrameStart > framePeriod) // too far behind to catch up so start counting from now
+		m_nextFrameStart = startTime;
+	priv_waitUntil(m_nextFrameStart);
+	m_nextFrameStart += framePeriod;
+	return Duration{ static_cast<long long int>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count()) };
+}
+
+inline Duration FrameLimiter::waitFor(const Duration time)
+{
+	const std::chrono::steady_clock::time_point startTime{ std::chrono::steady_clock::now() };
+	if (time.nano > 0ll)
+		priv_waitUntil(startTime + std::chrono::nanoseconds(time.nano));
+	return Duration{ static_cast<long long int>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count()) };
+}
+
+inline Duration FrameLimiter::waitForNextUpdate(const Timestep& timestep)
+{
+	const double timeUntilUpdate{ timestep.getTimeUntilUpdateRequired() };
+	if (timeUntilUpdate < 0.0) // no update pending (e.g. paused) so sleep for a whole period instead of polling
+		return waitFor((m_framePeriod.nano > 0ll) ? m_framePeriod : Duration{ 10 });
+	return waitFor(Duration{ timeUntilUpdate });
+}
+
+inline void FrameLimiter::reset()
+{
+	m_nextFrameStart = std::chrono::steady_clock::now();
+}
+
+
+
+// PRIVATE
+
+inline void FrameLimiter::priv_waitUntil(const std::chrono::steady_clock::time_point deadline)
+{
+	using std::chrono::steady_clock;
+	using std::chrono::nanoseconds;
+	using std::chrono::duration_cast;
+
+	// at least half of the wait is always slept so that a high overshoot estimate (or spin duration) can never turn the whole wait into spinning
+	const steady_clock::time_point sleepStart{ steady_clock::now() };
+	const long long int waitTime{ duration_cast<nanoseconds>(deadline - sleepStart).count() };
+	long long int spinTime{ m_overshootEstimate + m_spinDuration.nano };
+	if (spinTime > waitTime / 2)
+		spinTime = waitTime / 2;
+	const long long int sleepTime{ waitTime - spinTime };
+	if (sleepTime > 0ll)
+	{
+		std::this_thread::sleep_for(nanoseconds(sleepTime));
+		const long long int overshoot{ duration_cast<nanoseconds>(steady_clock::now() - sleepStart).count() - sleepTime };
+
+		// estimate rises quickly (late frames are worse than spinning) and falls slowly
+		if (overshoot > m_overshootEstimate)
+			m_overshootEstimate += (overshoot - m_overshootEstimate) / 2;
+		else
+			m_overshootEstimate -= (m_overshootEstimate - overshoot) / 64;
+		if (m_overshootEstimate < 0ll)
+			m_overshootEstimate = 0ll;
+	}
+	else
+		m_overshootEstimate -= m_overshootEstimate / 64; // no sleep to measure (already late) so the estimate still decays
+
+	while (steady_clock::now() < deadline)
+	{
+	}
+}
+
+} // namespace kairos
+#endif // KAIROS_FRAMELIMITER_INL
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Frame Time Tracker
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Frame time percentiles over fixed windows (using a log-linear histogram)
+
+// frame times are recorded in a histogram with fixed memory and constant-time recording.
+// each bucket's width is less than 1/64 of its values (under 1.6% error); values below 128ns are exact.
+// frame times longer than about 36 minutes are recorded in the final bucket (maximum is still exact).
+// histograms can be merged (e.g. from other threads or sessions).
+
+#ifndef KAIROS_FRAMETIMETRACKER_HPP
+#define KAIROS_FRAMETIMETRACKER_HPP
+
+#include "Stopwatch.hpp"
+
+#include <array>
+
+namespace kairos
+{
+
+class FrameTimeTracker
+{
+public:
+	class Histogram
+	{
+	public:
+		Histogram();
+		void clear();
+		void record(Duration frameTime);
+		void merge(const Histogram& histogram);
+		unsigned long long int getCount() const;
+		Duration getPercentile(double percentile) const; // percentile is 0 to 100 (e.g. 99.9). result is the highest value equivalent to the bucket
+		Duration getMin() const;
+		Duration getMax() const;
+		Duration getMean() const;
+
+	private:
+		static const unsigned int m_subBucketBits{ 7u };
+		static const unsigned int m_subBucketCount{ 1u << m_subBucketBits };
+		static const unsigned int m_maxShift{ 34u };
+		static const unsigned int m_bucketCount{ m_subBucketCount + m_maxShift * (m_subBucketCount / 2u) };
+
+		std::array<unsigned long long int, m_bucketCount> m_buckets;
+		unsigned long long int m_count;
+		long long int m_min;
+		long long int m_max;
+		long double m_sum;
+
+		static unsigned int priv_getBucketIndex(unsigned long long int value);
+		static unsigned long long int priv_getBucketHighestValue(unsigned int index);
+	};
+
+	FrameTimeTracker();
+	void update(); // update should be called every frame (measures time since the previous update)
+	void addFrame(Duration frameTime); // adds a frame time directly (instead of using update)
+	void reset(); // restarts clock and clears all histograms
+
+	void setWindow(Duration window); // length of each window (in total frame time). zero means windows are never completed
+	Duration getWindow() const;
+	const Histogram& getLastWindow() const; // most recently completed window
+	const Histogram& getCurrentWindow() const; // window currently being recorded
+	const Histogram& getTotal() const; // all frames since reset
+	unsigned long long int getNumberOfCompletedWindows() const;
+
+private:
+	Stopwatch m_clock;
+	Duration m_window;
+	Duration m_currentWindowTime;
+	unsigned long long int m_numberOfCompletedWindows;
+	Histogram m_currentWindow;
+	Histogram m_lastWindow;
+	Histogram m_total;
+};
+
+} // namespace kairos
+
+#include "FrameTimeTracker.inl"
+#endif // KAIROS_FRAMETIMETRACKER_HPP
@@ -0,0 +1,242 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Frame Time Tracker
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_FRAMETIMETRACKER_INL
+#define KAIROS_FRAMETIMETRACKER_INL
+
+#include "FrameTimeTracker.hpp"
+
+namespace kairos
+{
+
+inline FrameTimeTracker::FrameTimeTracker()
+	: m_clock()
+	, m_window(1.0)
+	, m_currentWindowTime()
+	, m_numberOfCompletedWindows(0u)
+	, m_currentWindow()
+	, m_lastWindow()
+	, m_total()
+{
+}
+
+inline void FrameTimeTracker::update()
+{
+	addFrame(m_clock.restart());
+}
+
+inline void FrameTimeTracker::addFrame(const Duration frameTime)
+{
+	m_currentWindow.record(frameTime);
+	m_total.record(frameTime);
+	m_currentWindowTime += frameTime;
+	if ((m_window.nano > 0ll) && !(m_currentWindowTime < m_window))
+	{
+		m_lastWindow = m_currentWindow;
+		m_currentWindow.clear();
+		m_currentWindowTime.zero();
+		++m_numberOfCompletedWindows;
+	}
+}
+
+inline void FrameTimeTracker::reset()
+{
+	m_clock.restart();
+	m_currentWindowTime.zero();
+	m_numberOfCompletedWindows = 0u;
+	m_currentWindow.clear();
+	m_lastWindow.clear();
+	m_total.clear();
+}
+
+inline void FrameTimeTracker::setWindow(const Duration window)
+{
+	m_window = window;
+}
+
+inline Duration FrameTimeTracker::getWindow() const
+{
+	return m_window;
+}
+
+inline const FrameTimeTracker::Histogram& FrameTimeTracker::getLastWindow() const
+{
+	return m_lastWindow;
+}
+
+inline const FrameTimeTracker::Histogram& FrameTimeTracker::getCurrentWindow() const
+{
+	return m_currentWindow;
+}
+
+inline const FrameTimeTracker::Histogram& FrameTimeTracker::getTotal() const
+{
+	return m_total;
+}
+
+inline unsigned long long int FrameTimeTracker::getNumberOfCompletedWindows() const
+{
+	return m_numberOfCompletedWindows;
+}
+
+
+
+/******************
+*                 *
+*    HISTOGRAM    *
+*                 *
+******************/
+
+inline FrameTimeTracker::Histogram::Histogram()
+{
+	clear();
+}
+
+inline void FrameTimeTracker::Histogram::clear()
+{
+	m_buckets.fill(0u);
+	m_count = 0u;
+	m_min = 0ll;
+	m_max = 0ll;
+	m_sum = 0.0L;
+}
+
+inline void FrameTimeTracker::Histogram::record(const Duration frameTime)
+{
+	const long long int value{ (frameTime.nano > 0ll) ? frameTime.nano : 0ll };
+	++m_buckets[priv_getBucketIndex(static_cast<unsigned long long int>(value))];
+	if ((m_count == 0u) || (value < m_min))
+		m_min = value;
+	if (value > m_max)
+		m_max = value;
+	m_sum += value;
+	++m_count;
+}
+
+inline void FrameTimeTracker::Histogram::merge(const Histogram& histogram)
+{
+	if (histogram.m_count == 0u)
+		return;
+	for (unsigned int i{ 0u }; i < m_bucketCount; ++i)
+		m_buckets[i] += histogram.m_buckets[i];
+	if ((m_count == 0u) || (histogram.m_min < m_min))
+		m_min = histogram.m_min;
+	if (histogram.m_max > m_max)
+		m_max = histogram.m_max;
+	m_sum += histogram.m_sum;
+	m_count += histogram.m_count;
+}
+
+inline unsigned long long int FrameTimeTracker::Histogram::getCount() const
+{
+	return m_count;
+}
+
+inline Duration FrameTimeTracker::Histogram::getPercentile(double percentile) const
+{
+	if (m_count == 0u)
+		return Duration{ 0ll };
+	if (percentile < 0.0)
+		percentile = 0.0;
+	else if (percentile > 100.0)
+		percentile = 100.0;
+
+	unsigned long long int target{ static_cast<unsigned long long int>(percentile / 100.0 * m_count + 0.5) };
+	if (target < 1u)
+		target = 1u;
+	unsigned long long int total{ 0u };
+	for (unsigned int i{ 0u }; i < m_bucketCount; ++i)
+	{
+		total += m_buckets[i];
+		if ((total >= target) && (i < m_bucketCount - 1u)) // final bucket has no upper limit so is represented by the maximum
+		{
+			const long long int highestValue{ static_cast<long long int>(priv_getBucketHighestValue(i)) };
+			return Duration{ (highestValue < m_max) ? highestValue : m_max };
+		}
+	}
+	return Duration{ m_max };
+}
+
+inline Duration FrameTimeTracker::Histogram::getMin() const
+{
+	return Duration{ m_min };
+}
+
+inline Duration FrameTimeTracker::Histogram::getMax() const
+{
+	return Duration{ m_max };
+}
+
+inline Duration FrameTimeTracker::Histogram::getMean() const
+{
+	return Duration{ (m_count > 0u) ? static_cast<long long int>(m_sum / m_count) : 0ll };
+}
+
+
+
+// PRIVATE
+
+inline unsigned int FrameTimeTracker::Histogram::priv_getBucketIndex(const unsigned long long int value)
+{
+	// values below the sub-bucket count are stored exactly.
+	// above that, each power of two is split into half the sub-bucket count
+	if (value < m_subBucketCount)
+		return static_cast<unsigned int>(value);
+
+	unsigned int highestBit{ 0u };
+	unsigned long long int remaining{ value };
+	for (unsigned int bits{ 32u }; bits > 0u; bits >>= 1u)
+	{
+		if ((remaining >> bits) != 0u)
+		{
+			remaining >>= bits;
+			highestBit += bits;
+		}
+	}
+	const unsigned int shift{ highestBit - m_subBucketBits + 1u };
+	if (shift > m_maxShift)
+		return m_bucketCount - 1u;
+	const unsigned int subBucket{ static_cast<unsigned int>(value >> shift) }; // from half the sub-bucket count to the sub-bucket count
+	return m_subBucketCount + (shift - 1u) * (m_subBucketCount / 2u) + (subBucket - m_subBucketCount / 2u);
+}
+
+inline unsigned long long int FrameTimeTracker::Histogram::priv_getBucketHighestValue(const unsigned int index)
+{
+	if (index < m_subBucketCount)
+		return index;
+	const unsigned int shift{ (index - m_subBucketCount) / (m_subBucketCount / 2u) + 1u };
+	const unsigned long long int subBucket{ (index - m_subBucketCount) % (m_subBucketCount / 2u) + m_subBucketCount / 2u };
+	return ((subBucket + 1u) << shift) - 1u;
+}
+
+} // namespace kairos
+#endif // KAIROS_FRAMETIMETRACKER_INL
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Hitch Detector
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Detects hitches (unusually long frames) and captures the frames leading up to them
+
+// the most recent frame times (and optional phase times within each frame) are kept in a ring buffer.
+// a frame is a hitch if it is longer than the threshold or longer than the median frame time (of the
+// previous frames, once the ring buffer is full) multiplied by the median multiplier.
+// when a hitch is detected, the ring buffer is copied (oldest first, ending with the hitch frame) and
+// passed to the callback. all memory is allocated when the capacity is set so frames do not allocate.
+
+#ifndef KAIROS_HITCHDETECTOR_HPP
+#define KAIROS_HITCHDETECTOR_HPP
+
+#include "Stopwatch.hpp"
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+namespace kairos
+{
+
+class HitchDetector
+{
+public:
+	struct Capture
+	{
+		std::vector<Duration> frameTimes; // oldest first; the final frame is the hitch
+		std::vector<Duration> phaseTimes; // number of phases per frame, in the same order as the frame times
+		std::size_t numberOfPhases;
+		Duration medianFrameTime; // median of the frames before the hitch (zero if not yet available)
+		unsigned long long int frameNumber; // number of the hitch frame since reset
+	};
+
+	HitchDetector();
+	HitchDetector(std::size_t frameCapacity, std::size_t numberOfPhases);
+	void setCapacity(std::size_t frameCapacity, std::size_t numberOfPhases); // allocates all memory (and resets)
+	void setThreshold(Duration threshold); // frames longer than this are hitches. zero disables
+	void setMedianMultiplier(double medianMultiplier); // frames longer than the median multiplied by this are hitches. zero disables
+	void setCallback(std::function<void(const Capture&)> callback);
+
+	void markPhase(std::size_t phase); // time since the previous mark (or frame start) is added to this phase
+	void addPhaseTime(std::size_t phase, Duration phaseTime); // adds a phase time directly (instead of using markPhase)
+	bool update(); // update should be called every frame (measures time since the previous update). returns true if the frame is a hitch
+	bool addFrame(Duration frameTime); // adds a frame time directly (instead of using update)
+	void reset();
+
+	const Capture& getLastCapture() const;
+	unsigned long long int getNumberOfHitches() const;
+
+private:
+	Stopwatch m_frameClock;
+	Stopwatch m_phaseClock;
+	std::size_t m_frameCapacity;
+	std::size_t m_numberOfPhases;
+	std::vector<Duration> m_frameTimes;
+	std::vector<Duration> m_phaseTimes;
+	std::vector<Duration> m_currentPhaseTimes;
+	std::vector<long long int> m_medianScratch;
+	std::size_t m_oldestIndex;
+	std::size_t m_numberOfFrames;
+	unsigned long long int m_frameNumber;
+	unsigned long long int m_numberOfHitches;
+	Duration m_threshold;
+	double m_medianMultiplier;
+	std::function<void(const Capture&)> m_callback;
+	Capture m_capture;
+
+	long long int priv_getMedianFrameTime();
+	void priv_capture(long long int medianFrameTime);
+};
+
+} // namespace kairos
+
+#include "HitchDetector.inl"
+#endif // KAIROS_HITCHDETECTOR_HPP
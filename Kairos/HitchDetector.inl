@@ -0,0 +1,213 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Hitch Detector
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_HITCHDETECTOR_INL
+#define KAIROS_HITCHDETECTOR_INL
+
+#include "HitchDetector.hpp"
+
+#include <algorithm> // for std::nth_element
+
+namespace kairos
+{
+
+inline HitchDetector::HitchDetector()
+	: HitchDetector(120u, 0u)
+{
+}
+
+inline HitchDetector::HitchDetector(const std::size_t frameCapacity, const std::size_t numberOfPhases)
+	: m_frameClock()
+	, m_phaseClock()
+	, m_frameCapacity(0u)
+	, m_numberOfPhases(0u)
+	, m_frameTimes()
+	, m_phaseTimes()
+	, m_currentPhaseTimes()
+	, m_medianScratch()
+	, m_oldestIndex(0u)
+	, m_numberOfFrames(0u)
+	, m_frameNumber(0u)
+	, m_numberOfHitches(0u)
+	, m_threshold(0.1)
+	, m_medianMultiplier(3.0)
+	, m_callback()
+	, m_capture()
+{
+	setCapacity(frameCapacity, numberOfPhases);
+}
+
+inline void HitchDetector::setCapacity(const std::size_t frameCapacity, const std::size_t numberOfPhases)
+{
+	m_frameCapacity = (frameCapacity > 0u) ? frameCapacity : 1u;
+	m_numberOfPhases = numberOfPhases;
+	m_frameTimes.assign(m_frameCapacity, Duration{ 0ll });
+	m_phaseTimes.assign(m_frameCapacity * m_numberOfPhases, Duration{ 0ll });
+	m_currentPhaseTimes.assign(m_numberOfPhases, Duration{ 0ll });
+	m_medianScratch.assign(m_frameCapacity, 0ll);
+	m_capture.frameTimes.clear();
+	m_capture.frameTimes.reserve(m_frameCapacity);
+	m_capture.phaseTimes.clear();
+	m_capture.phaseTimes.reserve(m_frameCapacity * m_numberOfPhases);
+	m_capture.numberOfPhases = m_numberOfPhases;
+	m_capture.medianFrameTime.zero();
+	m_capture.frameNumber = 0u;
+	reset();
+}
+
+inline void HitchDetector::setThreshold(const Duration threshold)
+{
+	m_threshold = threshold;
+}
+
+inline void HitchDetector::setMedianMultiplier(const double medianMultiplier)
+{
+	m_medianMultiplier = medianMultiplier;
+}
+
+inline void HitchDetector::setCallback(std::function<void(const Capture&)> callback)
+{
+	m_callback = callback;
+}
+
+inline void HitchDetector::markPhase(const std::size_t phase)
+{
+	addPhaseTime(phase, m_phaseClock.restart());
+}
+
+inline void HitchDetector::addPhaseTime(const std::size_t phase, const Duration phaseTime)
+{
+	if (phase < m_numberOfPhases)
+		m_currentPhaseTimes[phase] += phaseTime;
+}
+
+inline bool HitchDetector::update()
+{
+	m_phaseClock.restart();
+	return addFrame(m_frameClock.restart());
+}
+
+inline bool HitchDetector::addFrame(const Duration frameTime)
+{
+	// median is of the previous frames so is calculated before this frame is added
+	const long long int medianFrameTime{ (m_medianMultiplier > 0.0) && (m_numberOfFrames == m_frameCapacity) ? priv_getMedianFrameTime() : 0ll };
+
+	// add frame (replacing oldest if full)
+	std::size_t index{ m_oldestIndex + m_numberOfFrames };
+	if (m_numberOfFrames == m_frameCapacity)
+	{
+		index = m_oldestIndex;
+		if (++m_oldestIndex == m_frameCapacity)
+			m_oldestIndex = 0u;
+	}
+	else
+	{
+		if (index >= m_frameCapacity)
+			index -= m_frameCapacity;
+		++m_numberOfFrames;
+	}
+	m_frameTimes[index] = frameTime;
+	for (std::size_t phase{ 0u }; phase < m_numberOfPhases; ++phase)
+	{
+		m_phaseTimes[index * m_numberOfPhases + phase] = m_currentPhaseTimes[phase];
+		m_currentPhaseTimes[phase].zero();
+	}
+	++m_frameNumber;
+
+	const bool isOverThreshold{ (m_threshold.nano > 0ll) && (frameTime > m_threshold) };
+	const bool isOverMedian{ (medianFrameTime > 0ll) && (frameTime.nano > medianFrameTime * m_medianMultiplier) };
+	if (!isOverThreshold && !isOverMedian)
+		return false;
+
+	++m_numberOfHitches;
+	priv_capture(medianFrameTime);
+	if (m_callback)
+		m_callback(m_capture);
+	return true;
+}
+
+inline void HitchDetector::reset()
+{
+	m_frameClock.restart();
+	m_phaseClock.restart();
+	m_oldestIndex = 0u;
+	m_numberOfFrames = 0u;
+	m_frameNumber = 0u;
+	m_numberOfHitches = 0u;
+	for (auto& phaseTime : m_currentPhaseTimes)
+		phaseTime.zero();
+}
+
+inline const HitchDetector::Capture& HitchDetector::getLastCapture() const
+{
+	return m_capture;
+}
+
+inline unsigned long long int HitchDetector::getNumberOfHitches() const
+{
+	return m_numberOfHitches;
+}
+
+
+
+// PRIVATE
+
+inline long long int HitchDetector::priv_getMedianFrameTime()
+{
+	for (std::size_t i{ 0u }; i < m_numberOfFrames; ++i)
+		m_medianScratch[i] = m_frameTimes[i].nano;
+	const auto middle = m_medianScratch.begin() + m_numberOfFrames / 2u;
+	std::nth_element(m_medianScratch.begin(), middle, m_medianScratch.begin() + m_numberOfFrames);
+	return *middle;
+}
+
+inline void HitchDetector::priv_capture(const long long int medianFrameTime)
+{
+	// capacity was reserved in setCapacity so these do not allocate
+	m_capture.frameTimes.clear();
+	m_capture.phaseTimes.clear();
+	for (std::size_t i{ 0u }; i < m_numberOfFrames; ++i)
+	{
+		std::size_t index{ m_oldestIndex + i };
+		if (index >= m_frameCapacity)
+			index -= m_frameCapacity;
+		m_capture.frameTimes.push_back(m_frameTimes[index]);
+		for (std::size_t phase{ 0u }; phase < m_numberOfPhases; ++phase)
+			m_capture.phaseTimes.push_back(m_phaseTimes[index * m_numberOfPhases + phase]);
+	}
+	m_capture.numberOfPhases = m_numberOfPhases;
+	m_capture.medianFrameTime.nano = medianFrameTime;
+	m_capture.frameNumber = m_frameNumber;
+}
+
+} // namespace kairos
+#endif // KAIROS_HITCHDETECTOR_INL
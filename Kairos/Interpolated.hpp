@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Interpolated
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Double-buffered (previous and current) states for use with Timestep's interpolation alpha
+
+// swap() should be called once for every step (e.g. each time isUpdateRequired() returns true).
+// it only flips the buffers so, afterwards, the current state is the state from two steps ago
+// and must be completely overwritten (usually calculated from the previous state).
+// in-place updates of the current state (e.g. current += velocity * dt) would read that stale state.
+
+// T must support: T + T, T - T and T * alpha
+
+#ifndef KAIROS_INTERPOLATED_HPP
+#define KAIROS_INTERPOLATED_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace kairos
+{
+
+template <typename T>
+class Interpolated
+{
+public:
+	Interpolated();
+	explicit Interpolated(const T& state);
+	void reset(const T& state); // sets both previous and current states (no interpolation until the next step)
+	void swap(); // current state becomes previous state. current then holds the state from two steps ago: overwrite it completely (read the last state with getPrevious(), not getCurrent())
+	void push(const T& state); // swap() and then set current state
+	T& getCurrent();
+	const T& getCurrent() const;
+	const T& getPrevious() const;
+	template <typename TAlpha>
+	T sample(const TAlpha& alpha) const; // linear interpolation from previous state (alpha = 0) to current state (alpha = 1)
+
+private:
+	T m_states[2];
+	unsigned int m_currentIndex;
+};
+
+// Structure-of-arrays version: one element per object (e.g. an array of x positions)
+template <typename T>
+class InterpolatedArray
+{
+public:
+	InterpolatedArray();
+	explicit InterpolatedArray(std::size_t size);
+	void resize(std::size_t size);
+	std::size_t size() const;
+	void reset(); // copies current states into previous states (no interpolation until the next step)
+	void swap(); // current states become previous states (constant time; no elements are copied). current then holds the states from two steps ago: overwrite them completely (read the last states with getPrevious(), not getCurrent())
+	T* getCurrent();
+	const T* getCurrent() const;
+	const T* getPrevious() const;
+	T& operator[](std::size_t index); // current state of element
+	const T& operator[](std::size_t index) const; // current state of element
+	template <typename TAlpha>
+	T sample(std::size_t index, const TAlpha& alpha) const;
+	template <typename TAlpha>
+	void sample(const TAlpha& alpha, T* output) const; // output must have space for size() elements
+	template <typename TAlpha>
+	void sample(const TAlpha& alpha, std::vector<T>& output) const;
+
+private:
+	std::vector<T> m_previous;
+	std::vector<T> m_current;
+};
+
+} // namespace kairos
+
+#include "Interpolated.inl"
+#endif // KAIROS_INTERPOLATED_HPP
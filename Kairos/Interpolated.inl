@@ -0,0 +1,201 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Interpolated
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_INTERPOLATED_INL
+#define KAIROS_INTERPOLATED_INL
+
+#include "Interpolated.hpp"
+
+namespace kairos
+{
+
+template <typename T>
+inline Interpolated<T>::Interpolated()
+	: m_states()
+	, m_currentIndex(0u)
+{
+}
+
+template <typename T>
+inline Interpolated<T>::Interpolated(const T& state)
+	: m_states()
+	, m_currentIndex(0u)
+{
+	reset(state);
+}
+
+template <typename T>
+inline void Interpolated<T>::reset(const T& state)
+{
+	m_states[0u] = state;
+	m_states[1u] = state;
+}
+
+template <typename T>
+inline void Interpolated<T>::swap()
+{
+	m_currentIndex ^= 1u;
+}
+
+template <typename T>
+inline void Interpolated<T>::push(const T& state)
+{
+	swap();
+	m_states[m_currentIndex] = state;
+}
+
+template <typename T>
+inline T& Interpolated<T>::getCurrent()
+{
+	return m_states[m_currentIndex];
+}
+
+template <typename T>
+inline const T& Interpolated<T>::getCurrent() const
+{
+	return m_states[m_currentIndex];
+}
+
+template <typename T>
+inline const T& Interpolated<T>::getPrevious() const
+{
+	return m_states[m_currentIndex ^ 1u];
+}
+
+template <typename T>
+template <typename TAlpha>
+inline T Interpolated<T>::sample(const TAlpha& alpha) const
+{
+	const T& previous{ getPrevious() };
+	return previous + (getCurrent() - previous) * alpha;
+}
+
+
+
+template <typename T>
+inline InterpolatedArray<T>::InterpolatedArray()
+	: m_previous()
+	, m_current()
+{
+}
+
+template <typename T>
+inline InterpolatedArray<T>::InterpolatedArray(const std::size_t size)
+	: m_previous(size)
+	, m_current(size)
+{
+}
+
+template <typename T>
+inline void InterpolatedArray<T>::resize(const std::size_t size)
+{
+	m_previous.resize(size);
+	m_current.resize(size);
+}
+
+template <typename T>
+inline std::size_t InterpolatedArray<T>::size() const
+{
+	return m_current.size();
+}
+
+template <typename T>
+inline void InterpolatedArray<T>::reset()
+{
+	m_previous = m_current;
+}
+
+template <typename T>
+inline void InterpolatedArray<T>::swap()
+{
+	m_previous.swap(m_current);
+}
+
+template <typename T>
+inline T* InterpolatedArray<T>::getCurrent()
+{
+	return m_current.data();
+}
+
+template <typename T>
+inline const T* InterpolatedArray<T>::getCurrent() const
+{
+	return m_current.data();
+}
+
+template <typename T>
+inline const T* InterpolatedArray<T>::getPrevious() const
+{
+	return m_previous.data();
+}
+
+template <typename T>
+inline T& InterpolatedArray<T>::operator[](const std::size_t index)
+{
+	return m_current[index];
+}
+
+template <typename T>
+inline const T& InterpolatedArray<T>::operator[](const std::size_t index) const
+{
+	return m_current[index];
+}
+
+template <typename T>
+template <typename TAlpha>
+inline T InterpolatedArray<T>::sample(const std::size_t index, const TAlpha& alpha) const
+{
+	return m_previous[index] + (m_current[index] - m_previous[index]) * alpha;
+}
+
+template <typename T>
+template <typename TAlpha>
+inline void InterpolatedArray<T>::sample(const TAlpha& alpha, T* output) const
+{
+	// simple loop over contiguous arrays so that the compiler can vectorise it (for arithmetic types, alpha should be the same type as T)
+	const T* previous{ m_previous.data() };
+	const T* current{ m_current.data() };
+	const std::size_t numberOfElements{ m_current.size() };
+	for (std::size_t i{ 0u }; i < numberOfElements; ++i)
+		output[i] = previous[i] + (current[i] - previous[i]) * alpha;
+}
+
+template <typename T>
+template <typename TAlpha>
+inline void InterpolatedArray<T>::sample(const TAlpha& alpha, std::vector<T>& output) const
+{
+	output.resize(m_current.size());
+	sample(alpha, output.data());
+}
+
+} // namespace kairos
+#endif // KAIROS_INTERPOLATED_INL
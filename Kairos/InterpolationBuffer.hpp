@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Interpolation Buffer
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// WARNING: C++11 or later required (uses <atomic>)
+
+// Lock-free buffer for passing timed states from one thread (simulation) to another (rendering)
+
+// the writer fills getWriteState() and then calls publish() with the state's time (e.g. Timestep's getOverall()).
+// the reader calls update() and then interpolates between getPrevious() and getCurrent() using getInterpolationAlpha().
+// the reader's time must come from a clock shared with the writer and should lag by (at least) one step so that
+// it stays between the two states' times.
+
+// states are published in pairs (newest and second-newest) so the reader's previous and current states are always
+// consecutive published states, even if the writer publishes more than once between reads.
+// five slots are used: one for the writer, the newest published pair and the reader's pair (which may share a slot).
+// the reader announces the pair it uses so the writer only ever writes a slot that neither pair uses.
+// states are never copied; slots are passed between the threads by index.
+// a slot given to the writer holds an older state and should be completely overwritten.
+
+// only one thread may write and only one thread may read
+
+#ifndef KAIROS_INTERPOLATIONBUFFER_HPP
+#define KAIROS_INTERPOLATIONBUFFER_HPP
+
+#include <atomic>
+
+namespace kairos
+{
+
+template <typename T>
+class InterpolationBuffer
+{
+public:
+	InterpolationBuffer();
+
+	// writer
+	T& getWriteState();
+	void publish(double time); // makes the write state available to the reader, stamped with its time
+
+	// reader
+	bool update(); // takes the newest published state if there is one. returns true if a new state was taken
+	const T& getPrevious() const;
+	const T& getCurrent() const;
+	double getPreviousTime() const;
+	double getCurrentTime() const;
+	double getInterpolationAlpha(double time) const; // 0 at previous state's time, 1 at current state's time (clamped)
+
+private:
+	struct Slot
+	{
+		T state;
+		double time;
+	};
+
+	// a pair is stored as (previous index << m_pairShift) | current index
+	static const unsigned int m_numberOfSlots{ 5u };
+	static const unsigned int m_pairShift{ 4u };
+	static const unsigned int m_indexMask{ 15u };
+
+	// writer's data, published pair and reader's data are padded onto separate cache lines.
+	// (padding rather than alignas so that buffers can be allocated dynamically before C++17)
+	Slot m_slots[m_numberOfSlots];
+	char m_slotsPadding[64];
+	unsigned int m_writeIndex;
+	unsigned int m_publishedPair; // writer's copy of the newest published pair
+	char m_writerPadding[64];
+	std::atomic<unsigned int> m_published; // newest published pair
+	char m_publishedPadding[64];
+	std::atomic<unsigned int> m_readerPair; // pair in use by the reader
+	unsigned int m_previousIndex;
+	unsigned int m_currentIndex;
+
+	static unsigned int priv_makePair(unsigned int previousIndex, unsigned int currentIndex);
+};
+
+} // namespace kairos
+
+#include "InterpolationBuffer.inl"
+#endif // KAIROS_INTERPOLATIONBUFFER_HPP
@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Interpolation Buffer
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_INTERPOLATIONBUFFER_INL
+#define KAIROS_INTERPOLATIONBUFFER_INL
+
+#include "InterpolationBuffer.hpp"
+
+namespace kairos
+{
+
+template <typename T>
+inline InterpolationBuffer<T>::InterpolationBuffer()
+	: m_slots()
+	, m_slotsPadding()
+	, m_writeIndex(1u)
+	, m_publishedPair(priv_makePair(0u, 0u))
+	, m_writerPadding()
+	, m_published(priv_makePair(0u, 0u))
+	, m_publishedPadding()
+	, m_readerPair(priv_makePair(0u, 0u))
+	, m_previousIndex(0u)
+	, m_currentIndex(0u)
+{
+	for (auto& slot : m_slots)
+		slot.time = 0.0;
+}
+
+template <typename T>
+inline T& InterpolationBuffer<T>::getWriteState()
+{
+	return m_slots[m_writeIndex].state;
+}
+
+template <typename T>
+inline void InterpolationBuffer<T>::publish(const double time)
+{
+	m_slots[m_writeIndex].time = time;
+	m_publishedPair = priv_makePair(m_publishedPair & m_indexMask, m_writeIndex);
+	m_published.store(m_publishedPair);
+
+	// next write slot is any slot not in the published pair or the reader's pair.
+	// (the reader only ever changes to the published pair, which is already excluded)
+	const unsigned int readerPair{ m_readerPair.load() };
+	for (unsigned int index{ 0u }; index < m_numberOfSlots; ++index)
+	{
+		if ((index != (m_publishedPair & m_indexMask)) && (index != (m_publishedPair >> m_pairShift)) && (index != (readerPair & m_indexMask)) && (index != (readerPair >> m_pairShift)))
+		{
+			m_writeIndex = index;
+			break;
+		}
+	}
+}
+
+template <typename T>
+inline bool InterpolationBuffer<T>::update()
+{
+	unsigned int pair{ m_published.load() };
+	if (pair == priv_makePair(m_previousIndex, m_currentIndex))
+		return false;
+
+	// the pair is announced and then confirmed to still be the published pair so that the writer cannot have chosen either slot to write
+	m_readerPair.store(pair);
+	for (unsigned int publishedPair{ m_published.load() }; publishedPair != pair; publishedPair = m_published.load())
+	{
+		pair = publishedPair;
+		m_readerPair.store(pair);
+	}
+	m_previousIndex = pair >> m_pairShift;
+	m_currentIndex = pair & m_indexMask;
+	return true;
+}
+
+template <typename T>
+inline const T& InterpolationBuffer<T>::getPrevious() const
+{
+	return m_slots[m_previousIndex].state;
+}
+
+template <typename T>
+inline const T& InterpolationBuffer<T>::getCurrent() const
+{
+	return m_slots[m_currentIndex].state;
+}
+
+template <typename T>
+inline double InterpolationBuffer<T>::getPreviousTime() const
+{
+	return m_slots[m_previousIndex].time;
+}
+
+template <typename T>
+inline double InterpolationBuffer<T>::getCurrentTime() const
+{
+	return m_slots[m_currentIndex].time;
+}
+
+template <typename T>
+inline double InterpolationBuffer<T>::getInterpolationAlpha(const double time) const
+{
+	const double previousTime{ getPreviousTime() };
+	const double range{ getCurrentTime() - previousTime };
+	if (range == 0.0)
+		return 1.0;
+	const double alpha{ (time - previousTime) / range };
+	if (alpha < 0.0)
+		return 0.0;
+	return (alpha < 1.0) ? alpha : 1.0;
+}
+
+// PRIVATE
+
+template <typename T>
+inline unsigned int InterpolationBuffer<T>::priv_makePair(const unsigned int previousIndex, const unsigned int currentIndex)
+{
+	return (previousIndex << m_pairShift) | currentIndex;
+}
+
+} // namespace kairos
+#endif // KAIROS_INTERPOLATIONBUFFER_INL
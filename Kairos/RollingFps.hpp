@@ -0,0 +1,84 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Rolling Fps
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Frame rate averaged over the most recent frames (a sliding window)
+
+// frame times are kept in a fixed ring buffer with a running (integer) sum so each frame is constant time
+// with no allocation, and the values are up to date after every frame.
+// the window is the last N frames (frame capacity) and, optionally, limited to the last T seconds.
+
+#ifndef KAIROS_ROLLINGFPS_HPP
+#define KAIROS_ROLLINGFPS_HPP
+
+#include "Stopwatch.hpp"
+
+#include <vector>
+#include <cstddef>
+
+namespace kairos
+{
+
+class RollingFps
+{
+public:
+	RollingFps();
+	explicit RollingFps(std::size_t frameCapacity);
+	void setFrameCapacity(std::size_t frameCapacity); // maximum number of frames in the window (also clears the window)
+	std::size_t getFrameCapacity() const;
+	void setWindow(Duration window); // maximum total time of frames in the window. zero means no time limit
+	Duration getWindow() const;
+
+	void update(); // update should be called every frame (measures time since the previous update)
+	void addFrame(Duration frameTime); // adds a frame time directly (instead of using update)
+	void reset(); // restarts clock and clears the window
+
+	double getFps() const;
+	Duration getAverageFrameTime() const;
+	Duration getLastFrameTime() const;
+	Duration getTotalTime() const; // total time of frames in the window
+	std::size_t getNumberOfFrames() const; // number of frames in the window
+
+private:
+	Stopwatch m_clock;
+	std::vector<long long int> m_frameTimes;
+	std::size_t m_oldestIndex;
+	std::size_t m_numberOfFrames;
+	long long int m_totalTime;
+	Duration m_window;
+
+	void priv_removeOldestFrame();
+};
+
+} // namespace kairos
+
+#include "RollingFps.inl"
+#endif // KAIROS_ROLLINGFPS_HPP
@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Rolling Fps
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_ROLLINGFPS_INL
+#define KAIROS_ROLLINGFPS_INL
+
+#include "RollingFps.hpp"
+
+namespace kairos
+{
+
+inline RollingFps::RollingFps()
+	: RollingFps(60u)
+{
+}
+
+inline RollingFps::RollingFps(const std::size_t frameCapacity)
+	: m_clock()
+	, m_frameTimes()
+	, m_oldestIndex(0u)
+	, m_numberOfFrames(0u)
+	, m_totalTime(0ll)
+	, m_window(0ll)
+{
+	setFrameCapacity(frameCapacity);
+}
+
+inline void RollingFps::setFrameCapacity(const std::size_t frameCapacity)
+{
+	m_frameTimes.assign((frameCapacity > 0u) ? frameCapacity : 1u, 0ll);
+	m_oldestIndex = 0u;
+	m_numberOfFrames = 0u;
+	m_totalTime = 0ll;
+}
+
+inline std::size_t RollingFps::getFrameCapacity() const
+{
+	return m_frameTimes.size();
+}
+
+inline void RollingFps::setWindow(const Duration window)
+{
+	m_window = window;
+	if (m_window.nano <= 0ll)
+		return;
+	while ((m_numberOfFrames > 1u) && (m_totalTime > m_window.nano))
+		priv_removeOldestFrame();
+}
+
+inline Duration RollingFps::getWindow() const
+{
+	return m_window;
+}
+
+inline void RollingFps::update()
+{
+	addFrame(m_clock.restart());
+}
+
+inline void RollingFps::addFrame(const Duration frameTime)
+{
+	if (m_numberOfFrames == m_frameTimes.size())
+		priv_removeOldestFrame();
+
+	std::size_t newestIndex{ m_oldestIndex + m_numberOfFrames };
+	if (newestIndex >= m_frameTimes.size())
+		newestIndex -= m_frameTimes.size();
+	m_frameTimes[newestIndex] = frameTime.nano;
+	m_totalTime += frameTime.nano;
+	++m_numberOfFrames;
+
+	if (m_window.nano <= 0ll)
+		return;
+	while ((m_numberOfFrames > 1u) && (m_totalTime > m_window.nano))
+		priv_removeOldestFrame();
+}
+
+inline void RollingFps::reset()
+{
+	m_clock.restart();
+	m_oldestIndex = 0u;
+	m_numberOfFrames = 0u;
+	m_totalTime = 0ll;
+}
+
+inline double RollingFps::getFps() const
+{
+	return (m_totalTime > 0ll) ? m_numberOfFrames / Duration{ m_totalTime }.asSeconds() : 0.0;
+}
+
+inline Duration RollingFps::getAverageFrameTime() const
+{
+	return Duration{ (m_numberOfFrames > 0u) ? m_totalTime / static_cast<long long int>(m_numberOfFrames) : 0ll };
+}
+
+inline Duration RollingFps::getLastFrameTime() const
+{
+	if (m_numberOfFrames == 0u)
+		return Duration{ 0ll };
+	std::size_t newestIndex{ m_oldestIndex + m_numberOfFrames - 1u };
+	if (newestIndex >= m_frameTimes.size())
+		newestIndex -= m_frameTimes.size();
+	return Duration{ m_frameTimes[newestIndex] };
+}
+
+inline Duration RollingFps::getTotalTime() const
+{
+	return Duration{ m_totalTime };
+}
+
+inline std::size_t RollingFps::getNumberOfFrames() const
+{
+	return m_numberOfFrames;
+}
+
+
+
+// PRIVATE
+
+inline void RollingFps::priv_removeOldestFrame()
+{
+	m_totalTime -= m_frameTimes[m_oldestIndex];
+	if (++m_oldestIndex == m_frameTimes.size())
+		m_oldestIndex = 0u;
+	--m_numberOfFrames;
+}
+
+} // namespace kairos
+#endif // KAIROS_ROLLINGFPS_INL
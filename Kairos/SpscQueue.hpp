@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// SpscQueue
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+// WARNING: C++11 or later required (uses <atomic>)
+
+// Lock-free bounded queue for passing values from one thread (producer) to another (consumer)
+
+// capacity is rounded up to a power of two. push() fails (returns false) when the queue is full
+// and pop() fails when it is empty; neither ever blocks or allocates.
+
+// only one thread may push and only one thread may pop
+
+#ifndef KAIROS_SPSCQUEUE_HPP
+#define KAIROS_SPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace kairos
+{
+
+template <typename T>
+class SpscQueue
+{
+public:
+	explicit SpscQueue(std::size_t capacity = 1024u);
+	std::size_t getCapacity() const;
+
+	// producer
+	bool push(const T& value);
+	bool push(T&& value);
+
+	// consumer
+	bool pop(T& value); // value is moved out of the queue
+	bool isEmpty() const;
+	std::size_t getSize() const; // approximate when called while the producer is pushing
+
+private:
+	// producer's and consumer's data are padded onto separate cache lines.
+	// (padding rather than alignas so that queues can be allocated dynamically before C++17)
+	std::vector<T> m_values;
+	std::size_t m_indexMask;
+	char m_producerPadding[64];
+	std::atomic<std::size_t> m_writeCount;
+	std::size_t m_cachedReadCount; // producer's copy of the read count (only re-read when the queue seems full)
+	char m_consumerPadding[64];
+	std::atomic<std::size_t> m_readCount;
+	std::size_t m_cachedWriteCount; // consumer's copy of the write count (only re-read when the queue seems empty)
+
+	static std::size_t priv_getPowerOfTwo(std::size_t minimum);
+};
+
+} // namespace kairos
+
+#include "SpscQueue.inl"
+#endif // KAIROS_SPSCQUEUE_HPP
@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// SpscQueue
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef KAIROS_SPSCQUEUE_INL
+#define KAIROS_SPSCQUEUE_INL
+
+#include "SpscQueue.hpp"
+
+#include <utility>
+
+namespace kairos
+{
+
+template <typename T>
+inline SpscQueue<T>::SpscQueue(const std::size_t capacity)
+	: m_values(priv_getPowerOfTwo(capacity))
+	, m_indexMask(m_values.size() - 1u)
+	, m_producerPadding()
+	, m_writeCount(0u)
+	, m_cachedReadCount(0u)
+	, m_consumerPadding()
+	, m_readCount(0u)
+	, m_cachedWriteCount(0u)
+{
+}
+
+template <typename T>
+inline std::size_t SpscQueue<T>::getCapacity() const
+{
+	return m_values.size();
+}
+
+template <typename T>
+inline bool SpscQueue<T>::push(const T& value)
+{
+	// counts only increase (and wrap around) so their difference is always the number of values in the queue
+	const std::size_t writeCount{ m_writeCount.load(std::memory_order_relaxed) };
+	if (writeCount - m_cachedReadCount == m_values.size())
+	{
+		m_cachedReadCount = m_readCount.load(std::memory_order_acquire);
+		if (writeCount - m_cachedReadCount == m_values.size())
+			return false;
+	}
+	m_values[writeCount & m_indexMask] = value;
+	m_writeCount.store(writeCount + 1u, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::push(T&& value)
+{
+	const std::size_t writeCount{ m_writeCount.load(std::memory_order_relaxed) };
+	if (writeCount - m_cachedReadCount == m_values.size())
+	{
+		m_cachedReadCount = m_readCount.load(std::memory_order_acquire);
+		if (writeCount - m_cachedReadCount == m_values.size())
+			return false;
+	}
+	m_values[writeCount & m_indexMask] = std::move(value);
+	m_writeCount.store(writeCount + 1u, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::pop(T& value)
+{
+	const std::size_t readCount{ m_readCount.load(std::memory_order_relaxed) };
+	if (readCount == m_cachedWriteCount)
+	{
+		m_cachedWriteCount = m_writeCount.load(std::memory_order_acquire);
+		if (readCount == m_cachedWriteCount)
+			return false;
+	}
+	value = std::move(m_values[readCount & m_indexMask]);
+	m_readCount.store(readCount + 1u, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+inline bool SpscQueue<T>::isEmpty() const
+{
+	return getSize() == 0u;
+}
+
+template <typename T>
+inline std::size_t SpscQueue<T>::getSize() const
+{
+	return m_writeCount.load(std::memory_order_acquire) - m_readCount.load(std::memory_order_relaxed);
+}
+
+// PRIVATE
+
+template <typename T>
+inline std::size_t SpscQueue<T>::priv_getPowerOfTwo(const std::size_t minimum)
+{
+	std::size_t powerOfTwo{ 1u };
+	while (powerOfTwo < minimum)
+		powerOfTwo <<= 1u;
+	return powerOfTwo;
+}
+
+} // namespace kairos
+#endif // KAIROS_SPSCQUEUE_INL
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Tempo Map
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Maps step positions to time (and back) when the speed (steps per second) changes during playback
+
+// each tempo change starts a segment with a constant speed. the time at the start of every segment is
+// precalculated so conversions are a binary search (O(log n)) or, using a cursor for playback that
+// moves forwards, constant time (amortised).
+// there is always a segment at position zero; positions before zero use the first segment's speed.
+
+#ifndef KAIROS_TEMPOMAP_HPP
+#define KAIROS_TEMPOMAP_HPP
+
+#include "Absorel.hpp"
+#include "Duration.hpp"
+
+#include <vector>
+#include <cstddef>
+
+namespace kairos
+{
+
+class TempoMap
+{
+public:
+	struct Cursor
+	{
+		std::size_t segmentIndex{ 0u };
+	};
+
+	TempoMap();
+	void clear(double speed = 1.0); // removes all tempo changes and sets the speed from position zero
+	void addTempoChange(const Absorel& position, double speed); // speed (steps per second) from position onwards. replaces any tempo change at the same position. speed must be positive
+	std::size_t getNumberOfSegments() const;
+	Absorel getSegmentPosition(std::size_t segmentIndex) const;
+	double getSegmentSpeed(std::size_t segmentIndex) const;
+	Duration getSegmentTime(std::size_t segmentIndex) const;
+
+	Duration getTime(const Absorel& position) const;
+	Absorel getPosition(const Duration& time) const;
+	Duration getTime(const Absorel& position, Cursor& cursor) const; // faster when each position is near the previous position (using the same cursor)
+	Absorel getPosition(const Duration& time, Cursor& cursor) const; // faster when each time is near the previous time (using the same cursor)
+
+private:
+	std::vector<double> m_positions; // in steps
+	std::vector<double> m_speeds; // in steps per second
+	std::vector<double> m_times; // in seconds
+
+	void priv_updateTimes(std::size_t firstSegmentIndex);
+	std::size_t priv_findSegmentFromPosition(double position) const;
+	std::size_t priv_findSegmentFromTime(double time) const;
+	std::size_t priv_moveCursor(const std::vector<double>& starts, double value, Cursor& cursor) const;
+};
+
+} // namespace kairos
+
+#include "TempoMap.inl"
+#endif // KAIROS_TEMPOMAP_HPP
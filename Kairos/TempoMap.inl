@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Tempo Map
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_TEMPOMAP_INL
+#define KAIROS_TEMPOMAP_INL
+
+#include "TempoMap.hpp"
+
+#include <algorithm> // for std::upper_bound and std::lower_bound
+
+namespace kairos
+{
+
+inline TempoMap::TempoMap()
+	: m_positions()
+	, m_speeds()
+	, m_times()
+{
+	clear();
+}
+
+inline void TempoMap::clear(const double speed)
+{
+	m_positions.assign(1u, 0.0);
+	m_speeds.assign(1u, (speed > 0.0) ? speed : 1.0);
+	m_times.assign(1u, 0.0);
+}
+
+inline void TempoMap::addTempoChange(const Absorel& position, const double speed)
+{
+	if (speed <= 0.0)
+		return;
+
+	const double steps{ position.absolute + position.relative };
+	if (steps <= 0.0)
+	{
+		m_speeds[0u] = speed;
+		priv_updateTimes(1u);
+		return;
+	}
+
+	const std::size_t segmentIndex{ static_cast<std::size_t>(std::lower_bound(m_positions.begin(), m_positions.end(), steps) - m_positions.begin()) };
+	if ((segmentIndex < m_positions.size()) && (m_positions[segmentIndex] == steps))
+		m_speeds[segmentIndex] = speed;
+	else
+	{
+		m_positions.insert(m_positions.begin() + segmentIndex, steps);
+		m_speeds.insert(m_speeds.begin() + segmentIndex, speed);
+		m_times.insert(m_times.begin() + segmentIndex, 0.0);
+	}
+	priv_updateTimes(segmentIndex);
+}
+
+inline std::size_t TempoMap::getNumberOfSegments() const
+{
+	return m_positions.size();
+}
+
+inline Absorel TempoMap::getSegmentPosition(const std::size_t segmentIndex) const
+{
+	return Absorel{ m_positions[segmentIndex] };
+}
+
+inline double TempoMap::getSegmentSpeed(const std::size_t segmentIndex) const
+{
+	return m_speeds[segmentIndex];
+}
+
+inline Duration TempoMap::getSegmentTime(const std::size_t segmentIndex) const
+{
+	return Duration{ m_times[segmentIndex] };
+}
+
+inline Duration TempoMap::getTime(const Absorel& position) const
+{
+	const double steps{ position.absolute + position.relative };
+	const std::size_t segmentIndex{ priv_findSegmentFromPosition(steps) };
+	return Duration{ m_times[segmentIndex] + (steps - m_positions[segmentIndex]) / m_speeds[segmentIndex] };
+}
+
+inline Absorel TempoMap::getPosition(const Duration& time) const
+{
+	const double seconds{ time.asSeconds() };
+	const std::size_t segmentIndex{ priv_findSegmentFromTime(seconds) };
+	return Absorel{ m_positions[segmentIndex] + (seconds - m_times[segmentIndex]) * m_speeds[segmentIndex] };
+}
+
+inline Duration TempoMap::getTime(const Absorel& position, Cursor& cursor) const
+{
+	const double steps{ position.absolute + position.relative };
+	const std::size_t segmentIndex{ priv_moveCursor(m_positions, steps, cursor) };
+	return Duration{ m_times[segmentIndex] + (steps - m_positions[segmentIndex]) / m_speeds[segmentIndex] };
+}
+
+inline Absorel TempoMap::getPosition(const Duration& time, Cursor& cursor) const
+{
+	const double seconds{ time.asSeconds() };
+	const std::size_t segmentIndex{ priv_moveCursor(m_times, seconds, cursor) };
+	return Absorel{ m_positions[segmentIndex] + (seconds - m_times[segmentIndex]) * m_speeds[segmentIndex] };
+}
+
+
+
+// PRIVATE
+
+inline void TempoMap::priv_updateTimes(std::size_t firstSegmentIndex)
+{
+	if (firstSegmentIndex == 0u)
+		firstSegmentIndex = 1u;
+	for (std::size_t i{ firstSegmentIndex }; i < m_positions.size(); ++i)
+		m_times[i] = m_times[i - 1u] + (m_positions[i] - m_positions[i - 1u]) / m_speeds[i - 1u];
+}
+
+inline std::size_t TempoMap::priv_findSegmentFromPosition(const double position) const
+{
+	const std::size_t nextSegmentIndex{ static_cast<std::size_t>(std::upper_bound(m_positions.begin(), m_positions.end(), position) - m_positions.begin()) };
+	return (nextSegmentIndex > 0u) ? nextSegmentIndex - 1u : 0u;
+}
+
+inline std::size_t TempoMap::priv_findSegmentFromTime(const double time) const
+{
+	const std::size_t nextSegmentIndex{ static_cast<std::size_t>(std::upper_bound(m_times.begin(), m_times.end(), time) - m_times.begin()) };
+	return (nextSegmentIndex > 0u) ? nextSegmentIndex - 1u : 0u;
+}
+
+inline std::size_t TempoMap::priv_moveCursor(const std::vector<double>& starts, const double value, Cursor& cursor) const
+{
+	std::size_t segmentIndex{ (cursor.segmentIndex < starts.size()) ? cursor.segmentIndex : 0u };
+	if ((segmentIndex > 0u) && (value < starts[segmentIndex]))
+	{
+		// moved backwards so search instead
+		const std::size_t nextSegmentIndex{ static_cast<std::size_t>(std::upper_bound(starts.begin(), starts.begin() + segmentIndex, value) - starts.begin()) };
+		segmentIndex = (nextSegmentIndex > 0u) ? nextSegmentIndex - 1u : 0u;
+	}
+	else
+	{
+		while ((segmentIndex + 1u < starts.size()) && (starts[segmentIndex + 1u] <= value))
+			++segmentIndex;
+	}
+	cursor.segmentIndex = segmentIndex;
+	return segmentIndex;
+}
+
+} // namespace kairos
+#endif // KAIROS_TEMPOMAP_INL
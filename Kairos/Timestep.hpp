@@ -34,6 +34,7 @@
 #define KAIROS_TIMESTEP_HPP
 
 #include "Continuum.hpp"
+#include "TimestepLog.hpp"
 
 namespace kairos
 {
@@ -54,6 +55,7 @@ public:
 	float getOverallAsFloat() const;
 	double getTime() const; // amount of time accumulated
 	float getTimeAsFloat() const;
+	double getTimeUntilUpdateRequired() const; // real time until a step will have accumulated (zero if already accumulated; negative if no update is pending: paused, stopped, zero step or time speed, or time speed opposite to step)
 	void setMaxAccumulation(double maxAccumulation);
 	void setTimeSpeed(double timeSpeed);
 	double getTimeSpeed() const;
@@ -61,6 +63,13 @@ public:
 	void unpause();
 	bool isPaused() const;
 
+	void startRecording(TimestepLog& log); // frame times, pauses and time speed changes are added to the log (log must exist until recording stops)
+	void stopRecording();
+	bool isRecording() const;
+	void startReplay(const TimestepLog& log); // frame times are read from the log instead of the real time (log must exist until replay stops)
+	void stopReplay(); // replay also stops automatically at the end of the log
+	bool isReplaying() const;
+
 private:
 	Continuum m_continuum;
 	double m_step;
@@ -68,7 +77,11 @@ private:
 	double m_overall;
 	double m_maxAccumulation;
 	double m_timeSpeed;
+	TimestepLog* m_recordingLog;
+	const TimestepLog* m_replayLog;
+	std::size_t m_replayPosition;
 
+	void priv_addReplayFrame();
 	bool shouldBeZero(double a) const;
 };
 
@@ -44,6 +44,9 @@ inline Timestep::Timestep()
 	, m_overall(0.0)
 	, m_maxAccumulation(0.1)
 	, m_timeSpeed(1.0)
+	, m_recordingLog(nullptr)
+	, m_replayLog(nullptr)
+	, m_replayPosition(0u)
 {
 }
 
@@ -103,9 +106,16 @@ inline float Timestep::getInterpolationAlphaAsFloat() const
 
 inline void Timestep::addFrame()
 {
-	double frameTime{ m_continuum.reset().asSeconds() };
+	if (m_replayLog != nullptr)
+	{
+		priv_addReplayFrame();
+		return;
+	}
+	const Duration frameTime{ m_continuum.reset() };
 	m_continuum.setSpeed(m_timeSpeed);
-	m_accumulator += frameTime;
+	m_accumulator += frameTime.asSeconds();
+	if (m_recordingLog != nullptr)
+		m_recordingLog->addFrame(frameTime);
 }
 
 inline double Timestep::getOverall() const
@@ -127,6 +137,16 @@ inline float Timestep::getTimeAsFloat() const
 {
 	return static_cast<float>(getTime());
 }
+
+inline double Timestep::getTimeUntilUpdateRequired() const
+{
+	// time moving away from the next step (step and time speed in opposite directions) never requires an update
+	if (shouldBeZero(m_step) || shouldBeZero(m_timeSpeed) || ((m_step > 0.0) != (m_timeSpeed > 0.0)) || m_continuum.isStopped())
+		return -1.0;
+	const double timeUntilUpdate{ (m_step - m_accumulator - m_continuum.getTime().asSeconds()) / m_timeSpeed };
+	return (timeUntilUpdate > 0.0) ? timeUntilUpdate : 0.0;
+}
+
 inline void Timestep::setMaxAccumulation(double maxAccumulation)
 {
 	m_maxAccumulation = maxAccumulation < m_step ? m_step : maxAccumulation;
@@ -136,6 +156,8 @@ inline void Timestep::setTimeSpeed(double timeSpeed)
 {
 	m_timeSpeed = timeSpeed;
 	m_continuum.setSpeed(m_timeSpeed);
+	if (m_recordingLog != nullptr)
+		m_recordingLog->addTimeSpeed(m_timeSpeed);
 }
 
 inline double Timestep::getTimeSpeed() const
@@ -146,11 +168,15 @@ inline double Timestep::getTimeSpeed() const
 inline void Timestep::pause()
 {
 	m_continuum.stop();
+	if (m_recordingLog != nullptr)
+		m_recordingLog->addPause();
 }
 
 inline void Timestep::unpause()
 {
 	m_continuum.go();
+	if (m_recordingLog != nullptr)
+		m_recordingLog->addUnpause();
 }
 
 inline bool Timestep::isPaused() const
@@ -158,10 +184,74 @@ inline bool Timestep::isPaused() const
 	return m_continuum.isStopped();
 }
 
+inline void Timestep::startRecording(TimestepLog& log)
+{
+	m_recordingLog = &log;
+	m_recordingLog->addTimeSpeed(m_timeSpeed);
+	if (isPaused())
+		m_recordingLog->addPause();
+}
+
+inline void Timestep::stopRecording()
+{
+	m_recordingLog = nullptr;
+}
+
+inline bool Timestep::isRecording() const
+{
+	return m_recordingLog != nullptr;
+}
+
+inline void Timestep::startReplay(const TimestepLog& log)
+{
+	m_replayLog = &log;
+	m_replayPosition = 0u;
+}
+
+inline void Timestep::stopReplay()
+{
+	if (m_replayLog == nullptr)
+		return;
+	m_replayLog = nullptr;
+	m_continuum.reset(); // real time continues from now
+	m_continuum.setSpeed(m_timeSpeed);
+}
+
+inline bool Timestep::isReplaying() const
+{
+	return m_replayLog != nullptr;
+}
+
 
 
 // PRIVATE
 
+inline void Timestep::priv_addReplayFrame()
+{
+	TimestepLog::Entry entry;
+	while (m_replayLog->readEntry(m_replayPosition, entry))
+	{
+		switch (entry.type)
+		{
+		case TimestepLog::EntryType::Frame:
+			m_accumulator += entry.frameTime.asSeconds();
+			if (m_recordingLog != nullptr)
+				m_recordingLog->addFrame(entry.frameTime);
+			return;
+		case TimestepLog::EntryType::Pause:
+			pause();
+			break;
+		case TimestepLog::EntryType::Unpause:
+			unpause();
+			break;
+		case TimestepLog::EntryType::TimeSpeed:
+			setTimeSpeed(entry.timeSpeed);
+			break;
+		}
+	}
+	stopReplay();
+}
+
 inline bool Timestep::shouldBeZero(double a) const
 {
 	const double zeroEpsilon{ 0.00001 };
@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Timestep Bank
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Many TimestepLite-style timesteps stored as structure-of-arrays and updated together
+
+// update() adds the frame time to every accumulator. integrate() then integrates one step of every
+// timestep that has a step accumulated and returns the indices (and bitmask) of those timesteps.
+// integrate() should be called until it returns no indices, in the same way as TimestepLite's isTimeToIntegrate().
+
+// both are simple loops over contiguous arrays so that the compiler can vectorise them (e.g. with AVX2 enabled)
+
+#ifndef KAIROS_TIMESTEPBANK_HPP
+#define KAIROS_TIMESTEPBANK_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace kairos
+{
+
+class TimestepBank
+{
+public:
+	TimestepBank();
+	std::size_t add(double step); // returns index of new timestep
+	void reserve(std::size_t numberOfTimesteps);
+	void clear();
+	std::size_t size() const;
+
+	void update(double frameTime); // adds frame time to all timesteps
+	const std::vector<std::size_t>& integrate(); // returns indices of timesteps that were integrated (empty if none were)
+	const std::vector<unsigned long long int>& getIntegratedMask() const; // bitmask of timesteps integrated by the last integrate() (64 timesteps per element)
+
+	void setStep(std::size_t index, double step);
+	double getStep(std::size_t index) const;
+	double getOverall(std::size_t index) const;
+
+private:
+	std::vector<double> m_steps;
+	std::vector<double> m_accumulators;
+	std::vector<double> m_overalls;
+	std::vector<unsigned char> m_integrated;
+	std::vector<unsigned long long int> m_integratedMask;
+	std::vector<std::size_t> m_integratedIndices;
+};
+
+} // namespace kairos
+
+#include "TimestepBank.inl"
+#endif // KAIROS_TIMESTEPBANK_HPP
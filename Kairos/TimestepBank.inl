@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Timestep Bank
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_TIMESTEPBANK_INL
+#define KAIROS_TIMESTEPBANK_INL
+
+#include "TimestepBank.hpp"
+
+namespace kairos
+{
+
+inline TimestepBank::TimestepBank()
+	: m_steps()
+	, m_accumulators()
+	, m_overalls()
+	, m_integrated()
+	, m_integratedMask()
+	, m_integratedIndices()
+{
+}
+
+inline std::size_t TimestepBank::add(const double step)
+{
+	m_steps.push_back(0.0);
+	m_accumulators.push_back(0.0);
+	m_overalls.push_back(0.0);
+	m_integrated.push_back(0u);
+	m_integratedMask.resize((m_steps.size() + 63u) / 64u);
+	setStep(m_steps.size() - 1u, step);
+	return m_steps.size() - 1u;
+}
+
+inline void TimestepBank::reserve(const std::size_t numberOfTimesteps)
+{
+	m_steps.reserve(numberOfTimesteps);
+	m_accumulators.reserve(numberOfTimesteps);
+	m_overalls.reserve(numberOfTimesteps);
+	m_integrated.reserve(numberOfTimesteps);
+	m_integratedMask.reserve((numberOfTimesteps + 63u) / 64u);
+	m_integratedIndices.reserve(numberOfTimesteps);
+}
+
+inline void TimestepBank::clear()
+{
+	m_steps.clear();
+	m_accumulators.clear();
+	m_overalls.clear();
+	m_integrated.clear();
+	m_integratedMask.clear();
+	m_integratedIndices.clear();
+}
+
+inline std::size_t TimestepBank::size() const
+{
+	return m_steps.size();
+}
+
+inline void TimestepBank::update(const double frameTime)
+{
+	double* accumulators{ m_accumulators.data() };
+	const std::size_t numberOfTimesteps{ m_accumulators.size() };
+	for (std::size_t i{ 0u }; i < numberOfTimesteps; ++i)
+		accumulators[i] += frameTime;
+}
+
+inline const std::vector<std::size_t>& TimestepBank::integrate()
+{
+	const double* steps{ m_steps.data() };
+	double* accumulators{ m_accumulators.data() };
+	double* overalls{ m_overalls.data() };
+	unsigned char* integrated{ m_integrated.data() };
+	const std::size_t numberOfTimesteps{ m_steps.size() };
+
+	// branch-free pass: a timestep that is not integrated has zero added/subtracted
+	for (std::size_t i{ 0u }; i < numberOfTimesteps; ++i)
+	{
+		const double step{ steps[i] };
+		const double accumulator{ accumulators[i] };
+		const int isIntegrated{ ((step > 0.0) & (accumulator >= step)) | ((step < 0.0) & (accumulator <= step)) }; // non-short-circuit operators avoid branches
+		const double integratedStep{ step * static_cast<double>(isIntegrated) };
+		accumulators[i] = accumulator - integratedStep;
+		overalls[i] += integratedStep;
+		integrated[i] = static_cast<unsigned char>(isIntegrated);
+	}
+
+	// compact into bitmask and indices
+	m_integratedIndices.clear();
+	for (std::size_t block{ 0u }; block < m_integratedMask.size(); ++block)
+	{
+		const std::size_t begin{ block * 64u };
+		const std::size_t end{ (begin + 64u < numberOfTimesteps) ? begin + 64u : numberOfTimesteps };
+		unsigned long long int mask{ 0u };
+		for (std::size_t i{ begin }; i < end; ++i)
+			mask |= static_cast<unsigned long long int>(integrated[i]) << (i - begin);
+		m_integratedMask[block] = mask;
+		for (std::size_t i{ begin }; mask != 0u; ++i, mask >>= 1u)
+		{
+			if ((mask & 1u) != 0u)
+				m_integratedIndices.push_back(i);
+		}
+	}
+	return m_integratedIndices;
+}
+
+inline const std::vector<unsigned long long int>& TimestepBank::getIntegratedMask() const
+{
+	return m_integratedMask;
+}
+
+inline void TimestepBank::setStep(const std::size_t index, const double step)
+{
+	// matches TimestepLite: near-zero steps become zero (and are never integrated)
+	const double zeroEpsilon{ 0.00001 };
+	m_steps[index] = (step < zeroEpsilon && step > -zeroEpsilon) ? 0.0 : step;
+}
+
+inline double TimestepBank::getStep(const std::size_t index) const
+{
+	return m_steps[index];
+}
+
+inline double TimestepBank::getOverall(const std::size_t index) const
+{
+	return (m_overalls[index] > m_steps[index]) ? m_overalls[index] - m_steps[index] : 0.0;
+}
+
+} // namespace kairos
+#endif // KAIROS_TIMESTEPBANK_INL
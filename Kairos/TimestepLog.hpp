@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Timestep Log
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Compact binary log of a Timestep's frame times, pauses and time speed changes (for recording and replaying)
+
+// each frame is stored as a single variable-length integer (nanoseconds, usually 4 bytes).
+// pause and unpause are stored as a single byte; time speed is stored as a byte followed by 8 bytes.
+
+#ifndef KAIROS_TIMESTEPLOG_HPP
+#define KAIROS_TIMESTEPLOG_HPP
+
+#include "Duration.hpp"
+
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <cstddef>
+
+namespace kairos
+{
+
+class TimestepLog
+{
+public:
+	enum class EntryType
+	{
+		Frame,
+		Pause,
+		Unpause,
+		TimeSpeed
+	};
+
+	struct Entry
+	{
+		EntryType type;
+		Duration frameTime; // Frame only
+		double timeSpeed; // TimeSpeed only
+	};
+
+	TimestepLog();
+	void clear();
+	bool isEmpty() const;
+	std::size_t getSize() const; // size in bytes
+	std::size_t getNumberOfFrames() const;
+	const std::vector<unsigned char>& getData() const;
+
+	void addFrame(Duration frameTime);
+	void addPause();
+	void addUnpause();
+	void addTimeSpeed(double timeSpeed);
+	bool readEntry(std::size_t& position, Entry& entry) const; // reads the entry at position (in bytes) and moves position to the next entry. returns false if there are no more entries
+
+	bool save(std::ostream& stream) const;
+	bool load(std::istream& stream); // returns false (and leaves the log empty) if the stream does not contain a valid log
+
+private:
+	std::vector<unsigned char> m_data;
+	std::size_t m_numberOfFrames;
+
+	void priv_addVarint(unsigned long long int value);
+	bool priv_readVarint(std::size_t& position, unsigned long long int& value) const;
+};
+
+} // namespace kairos
+
+#include "TimestepLog.inl"
+#endif // KAIROS_TIMESTEPLOG_HPP
@@ -0,0 +1,229 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// Timestep Log
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef KAIROS_TIMESTEPLOG_INL
+#define KAIROS_TIMESTEPLOG_INL
+
+#include "TimestepLog.hpp"
+
+#include <cstring> // for std::memcpy
+
+namespace kairos
+{
+
+namespace priv
+{
+
+// entry types are stored in the lowest 2 bits of an entry's first variable-length integer
+const unsigned long long int timestepLogTypeBits{ 2u };
+const unsigned long long int timestepLogTypeMask{ 3u };
+
+const char timestepLogMagic[4]{ 'K', 'T', 'S', 'L' };
+const unsigned char timestepLogVersion{ 1u };
+
+} // namespace priv
+
+inline TimestepLog::TimestepLog()
+	: m_data()
+	, m_numberOfFrames(0u)
+{
+}
+
+inline void TimestepLog::clear()
+{
+	m_data.clear();
+	m_numberOfFrames = 0u;
+}
+
+inline bool TimestepLog::isEmpty() const
+{
+	return m_data.empty();
+}
+
+inline std::size_t TimestepLog::getSize() const
+{
+	return m_data.size();
+}
+
+inline std::size_t TimestepLog::getNumberOfFrames() const
+{
+	return m_numberOfFrames;
+}
+
+inline const std::vector<unsigned char>& TimestepLog::getData() const
+{
+	return m_data;
+}
+
+inline void TimestepLog::addFrame(const Duration frameTime)
+{
+	// zigzag encoding keeps small negative values (from negative time speeds) small
+	const unsigned long long int zigzag{ (static_cast<unsigned long long int>(frameTime.nano) << 1u) ^ static_cast<unsigned long long int>(frameTime.nano >> 63) };
+	priv_addVarint((zigzag << priv::timestepLogTypeBits) | static_cast<unsigned long long int>(EntryType::Frame));
+	++m_numberOfFrames;
+}
+
+inline void TimestepLog::addPause()
+{
+	priv_addVarint(static_cast<unsigned long long int>(EntryType::Pause));
+}
+
+inline void TimestepLog::addUnpause()
+{
+	priv_addVarint(static_cast<unsigned long long int>(EntryType::Unpause));
+}
+
+inline void TimestepLog::addTimeSpeed(const double timeSpeed)
+{
+	priv_addVarint(static_cast<unsigned long long int>(EntryType::TimeSpeed));
+	unsigned long long int bits;
+	std::memcpy(&bits, &timeSpeed, sizeof(bits));
+	for (unsigned int i{ 0u }; i < 8u; ++i)
+		m_data.push_back(static_cast<unsigned char>(bits >> (i * 8u)));
+}
+
+inline bool TimestepLog::readEntry(std::size_t& position, Entry& entry) const
+{
+	unsigned long long int value;
+	std::size_t readPosition{ position };
+	if (!priv_readVarint(readPosition, value))
+		return false;
+
+	entry.type = static_cast<EntryType>(value & priv::timestepLogTypeMask);
+	entry.frameTime.nano = 0ll;
+	entry.timeSpeed = 0.0;
+	if (entry.type == EntryType::Frame)
+	{
+		const unsigned long long int zigzag{ value >> priv::timestepLogTypeBits };
+		entry.frameTime.nano = static_cast<long long int>(zigzag >> 1u) ^ -static_cast<long long int>(zigzag & 1u);
+	}
+	else if (entry.type == EntryType::TimeSpeed)
+	{
+		if (readPosition + 8u > m_data.size())
+			return false;
+		unsigned long long int bits{ 0u };
+		for (unsigned int i{ 0u }; i < 8u; ++i)
+			bits |= static_cast<unsigned long long int>(m_data[readPosition + i]) << (i * 8u);
+		std::memcpy(&entry.timeSpeed, &bits, sizeof(bits));
+		readPosition += 8u;
+	}
+	position = readPosition;
+	return true;
+}
+
+inline bool TimestepLog::save(std::ostream& stream) const
+{
+	stream.write(priv::timestepLogMagic, 4);
+	stream.put(static_cast<char>(priv::timestepLogVersion));
+	unsigned long long int size{ m_data.size() };
+	for (unsigned int i{ 0u }; i < 8u; ++i)
+		stream.put(static_cast<char>(size >> (i * 8u)));
+	if (!m_data.empty())
+		stream.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+	return static_cast<bool>(stream);
+}
+
+inline bool TimestepLog::load(std::istream& stream)
+{
+	clear();
+	char magic[4];
+	if (!stream.read(magic, 4) || std::memcmp(magic, priv::timestepLogMagic, 4) != 0)
+		return false;
+	if (stream.get() != priv::timestepLogVersion)
+		return false;
+	unsigned char sizeBytes[8];
+	if (!stream.read(reinterpret_cast<char*>(sizeBytes), 8))
+		return false;
+	unsigned long long int size{ 0u };
+	for (unsigned int i{ 0u }; i < 8u; ++i)
+		size |= static_cast<unsigned long long int>(sizeBytes[i]) << (i * 8u);
+
+	// read in chunks so that a corrupt size cannot allocate more than the stream actually contains
+	const unsigned long long int chunkSize{ 65536u };
+	while (size > 0u)
+	{
+		const std::size_t readSize{ static_cast<std::size_t>((size < chunkSize) ? size : chunkSize) };
+		const std::size_t offset{ m_data.size() };
+		m_data.resize(offset + readSize);
+		if (!stream.read(reinterpret_cast<char*>(m_data.data() + offset), static_cast<std::streamsize>(readSize)))
+		{
+			clear();
+			return false;
+		}
+		size -= readSize;
+	}
+
+	// validate the entries and count the frames
+	std::size_t position{ 0u };
+	Entry entry;
+	while (readEntry(position, entry))
+	{
+		if (entry.type == EntryType::Frame)
+			++m_numberOfFrames;
+	}
+	if (position != m_data.size())
+	{
+		clear();
+		return false;
+	}
+	return true;
+}
+
+
+
+// PRIVATE
+
+inline void TimestepLog::priv_addVarint(unsigned long long int value)
+{
+	while (value >= 0x80u)
+	{
+		m_data.push_back(static_cast<unsigned char>(value | 0x80u));
+		value >>= 7u;
+	}
+	m_data.push_back(static_cast<unsigned char>(value));
+}
+
+inline bool TimestepLog::priv_readVarint(std::size_t& position, unsigned long long int& value) const
+{
+	value = 0u;
+	for (unsigned int shift{ 0u }; (shift < 64u) && (position < m_data.size()); shift += 7u)
+	{
+		const unsigned char byte{ m_data[position++] };
+		value |= static_cast<unsigned long long int>(byte & 0x7Fu) << shift;
+		if ((byte & 0x80u) == 0u)
+			return true;
+	}
+	return false;
+}
+
+} // namespace kairos
+#endif // KAIROS_TIMESTEPLOG_INL
@@ -35,7 +35,9 @@
 
 #include "Absorel.hpp"
 #include "Duration.hpp"
+#include "FixedAbsorel.hpp"
 #include "Stopwatch.hpp"
+#include "TempoMap.hpp"
 #include <vector>
 #include <string>
 
@@ -48,16 +50,34 @@ class Yalpes
 {
 public:
 	struct Event;
+	class EventRange;
 	class Track;
 
 	std::vector<Track> tracks;
 
 	Yalpes();
 	void update();
+	void update(const Duration& lookahead); // updates to the play time plus lookahead so events are reached early (e.g. to schedule them ahead)
+
+	// sample-accurate alternative to update() for audio: play time is counted in samples (from the start of playback) instead of by the playback clock.
+	// calls callback(trackIndex, event, sampleOffset) in position order for each event reached by the block's last sample (offset is from the block's start sample
+	// and is the first sample at or after the event's play time). does nothing if block size is zero.
+	// events are always removed from events waiting; update() should not be used while rendering blocks
+	template <typename TCallback>
+	void renderBlock(double sampleRate, unsigned long long int startSample, unsigned int blockSize, TCallback callback);
 
 	void moveEventsInQueueBeforeCurrentPositionToWaiting();
 	void prepareEventQueue();
 
+	// live editing: keeps a prepared event queue in order and the playback cursor in place (no need to stop and prepare again).
+	// by default, play() prepares every activated track's event queue again. while live editing is enabled, play() only prepares tracks
+	// whose number of events has changed so events must then only be changed by these (or followed by prepareEventQueue())
+	void enableLiveEditing();
+	void disableLiveEditing();
+	void insertEvent(std::size_t trackIndex, const Event& event);
+	void removeEvent(std::size_t trackIndex, std::size_t eventIndex); // event index is index in track's events
+	void moveEvent(std::size_t trackIndex, std::size_t eventIndex, const Absorel& position);
+
 	void play();
 	void stop();
 	void pause();
@@ -68,8 +88,21 @@ public:
 	void rewind();
 
 	void setSpeed(double speed);
+	void setTempoMap(const TempoMap* tempoMap); // speed is ignored while a tempo map is used. tempo map must exist while it is used (nullptr stops using it)
 	void setSubsteps(unsigned int substeps);
 
+	// while the loop is enabled, playback jumps back to the loop start when it reaches the loop end (events waiting include the events passed on both sides of the loop point)
+	void setLoop(const Absorel& start, const Absorel& end); // ignored unless start is before end
+	void enableLoop(); // ignored unless a loop has been set
+	void disableLoop();
+
+	// calls callback(trackIndex, event) for every waiting event of every track in position order (ties are in track order).
+	// events are merged in place (no events are copied)
+	template <typename TCallback>
+	void forEachWaitingEvent(TCallback callback);
+	template <typename TCallback>
+	void forEachWaitingEventWithPlayTime(TCallback callback); // calls callback(trackIndex, event, playTime) where play time is when the event's position was reached (see getPlayTime)
+
 	void automaticallyRemoveWaitingEventsOnNextUpdate();
 	void doNotAutomaticallyRemoveWaitingEventsOnNextUpdate();
 
@@ -77,23 +110,61 @@ public:
 	Absorel getPosition() const;
 	Duration getPlayTime() const;
 	double getSpeed() const;
+	const TempoMap* getTempoMap() const;
 	unsigned int getSubsteps() const;
+	bool isLoopEnabled() const;
+	bool isLiveEditingEnabled() const;
+	Absorel getLoopStart() const;
+	Absorel getLoopEnd() const;
 	std::string stringFromPosition(const Absorel& position) const;
 	unsigned int getNumberOfTracks() const;
 	unsigned int getNumberOfActiveTracks() const;
 
 private:
+	template <typename>
+	friend class YalpesSong; // loads event queues directly
+
+	struct MergeEntry;
+
 	bool m_doAutomaticallyRemoveWaitingEventsOnNextUpdate{ true };
 	bool m_isPlaying{ false };
 	Stopwatch m_playbackClock;
 	double m_speed{ 1.0 };
 	unsigned int m_substeps{ 4u };
-	Absorel m_currentPosition{ { 0, 0.0 } };
-	Absorel m_playbackStartingPosition{ { 0, 0.0 } };
+	Absorel m_currentPosition{ 0, 0.0 };
+	Absorel m_playbackStartingPosition{ 0, 0.0 };
 	unsigned int m_lengthInSteps{ 0u };
-
-	void orderEvents(std::vector<Event>& events);
+	const TempoMap* m_tempoMap{ nullptr };
+	TempoMap::Cursor m_tempoMapCursor;
+	Duration m_playbackStartingTime;
+	Absorel m_previousPlaybackStartingPosition{ 0, 0.0 }; // playback start before the loop last wrapped
+	Duration m_previousPlaybackStartingTime;
+	bool m_isLoopEnabled{ false };
+	bool m_isLiveEditingEnabled{ false };
+	Absorel m_loopStart{ 0, 0.0 };
+	Absorel m_loopEnd{ 0, 0.0 };
+	std::vector<unsigned long long int> m_sortKeys; // scratch space for ordering events (reused to avoid allocations)
+	std::vector<unsigned long long int> m_sortKeysBuffer;
+	std::vector<std::size_t> m_sortIndicesBuffer;
+	std::vector<MergeEntry> m_mergeHeap; // reused by forEachWaitingEvent to avoid allocations
+
+	Absorel positionFromPlayTime(const Duration& playTime);
+	template <typename TCallback>
+	void mergeWaitingEvents(TCallback callback);
+	void updateToPlayTime(const Duration& playTime, bool doRemoveWaitingEvents);
+	void wrapLoop(const Duration& playTime);
+	Duration playTimeFromPosition(const Absorel& position, bool isBeforeLoopPoint) const;
+	MergeEntry getMergeEntry(std::size_t trackIndex, std::size_t index) const;
+	void orderEvents(Track& track);
+	bool isEventQueuePrepared(const Track& track) const;
+	std::size_t findInEventQueue(const Track& track, const Absorel& position, std::size_t eventIndex) const;
+	void insertIntoEventQueue(Track& track, std::size_t eventIndex);
+	void eraseFromEventQueue(Track& track, std::size_t queueIndex);
+	void updateLengthInSteps();
+	unsigned int stepsFromPosition(const Absorel& position) const;
+	static unsigned long long int sortKeyFromPosition(const Absorel& position);
 	std::string stringFromPositionWithSubsteps(const Absorel& position, unsigned int substeps) const;
+	void placeCursors();
 	void resetEventsWaiting();
 };
 
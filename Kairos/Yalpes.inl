@@ -35,8 +35,11 @@
 
 #include "Yalpes.hpp"
 
-#include <algorithm> // for std::sort
+#include <algorithm> // for std::max, std::lower_bound and heap functions
+#include <functional> // for std::greater
+#include <iterator> // for std::forward_iterator_tag
 #include <cmath>
+#include <utility> // for std::move
 
 namespace kairos
 {
@@ -60,24 +63,108 @@ struct Yalpes<TData>::Event
 	bool operator>(const Event& e) const;
 };
 
+template <typename TData>
+// Next waiting event of a track when merging tracks
+struct Yalpes<TData>::MergeEntry
+{
+	unsigned int pass;
+	unsigned long long int key;
+	std::size_t trackIndex;
+	std::size_t index; // index in track's events waiting
+
+	bool operator>(const MergeEntry& entry) const; // (pass, key, track index) order. greater is used so that the heap's top is the earliest
+};
+
+template <typename TData>
+// View of a range of events in a track's event queue (events are not copied)
+// when the loop point has been passed, the range is in two parts: the events before the loop end followed by the events after the loop start
+class Yalpes<TData>::EventRange
+{
+public:
+	class Iterator;
+
+	EventRange();
+	Iterator begin() const;
+	Iterator end() const;
+	std::size_t size() const;
+	bool empty() const;
+	const Event& operator[](std::size_t index) const;
+	const Event& front() const;
+	const Event& back() const;
+	void clear(); // removes the events from this range (they are not removed from the event queue)
+
+private:
+	friend class Yalpes;
+	friend class Track;
+
+	const std::vector<Event>* m_events{ nullptr };
+	std::size_t m_previousFirst{ 0u }; // events passed before the loop point (empty unless the loop point has been passed)
+	std::size_t m_previousLast{ 0u };
+	std::size_t m_first{ 0u };
+	std::size_t m_last{ 0u };
+
+	std::size_t getPreviousSize() const;
+	std::size_t getQueueIndex(std::size_t index) const;
+	void reset(std::size_t queueIndex); // empty range at the queue index
+};
+
+template <typename TData>
+// Forward iterator over the events in an event range
+class Yalpes<TData>::EventRange::Iterator
+{
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef Event value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const Event* pointer;
+	typedef const Event& reference;
+
+	Iterator(const EventRange& range, std::size_t index);
+	const Event& operator*() const;
+	const Event* operator->() const;
+	Iterator& operator++();
+	Iterator operator++(int);
+	bool operator==(const Iterator& iterator) const;
+	bool operator!=(const Iterator& iterator) const;
+
+private:
+	const EventRange* m_range;
+	std::size_t m_index;
+};
+
 template <typename TData>
 // Individual track of events that run in parallel with the other tracks
 class Yalpes<TData>::Track
 {
 public:
 	std::vector<Event> events;
-	std::vector<Event> eventQueue;
-	std::vector<Event> eventsWaiting;
+	std::vector<Event> eventQueue; // events in order. playback moves a cursor through the queue; events are not removed. empty if events are already in order (events are then used as the queue)
+	EventRange eventsWaiting; // events passed since they were last removed (see automaticallyRemoveWaitingEventsOnNextUpdate)
 
 	Track();
+	Track(const Track& track);
+	Track(Track&& track) noexcept;
+	Track& operator=(const Track& track);
+	Track& operator=(Track&& track) noexcept;
 	void activate();
 	void deactivate();
 	bool isActivated() const;
 
 private:
+	friend class Yalpes;
+	template <typename>
+	friend class YalpesSong;
+
 	bool m_isActivated{ true };
+	std::size_t m_cursor{ 0u }; // index in event queue of the first event not yet passed
+	std::vector<std::size_t> m_eventIndices; // index in events of each event in the event queue
+	std::vector<unsigned long long int> m_queueKeys; // fixed-point position of each event in the event queue (scanned instead of the events themselves)
+	bool m_isQueueInEvents{ false }; // events are already in order so are used as the queue instead of a copy
 
 	void setActivated(bool activated);
+	void setQueueInEvents(bool isQueueInEvents);
+	void separateQueueFromEvents();
+	const std::vector<Event>& getQueue() const;
 };
 
 
@@ -129,43 +216,55 @@ template <typename TData>
 inline void Yalpes<TData>::update()
 {
 	if (m_isPlaying)
+		updateToPlayTime(getPlayTime(), m_doAutomaticallyRemoveWaitingEventsOnNextUpdate);
+}
+
+template <typename TData>
+inline void Yalpes<TData>::update(const Duration& lookahead)
+{
+	if (m_isPlaying)
+		updateToPlayTime(getPlayTime() + lookahead, m_doAutomaticallyRemoveWaitingEventsOnNextUpdate);
+}
+
+template <typename TData>
+template <typename TCallback>
+inline void Yalpes<TData>::renderBlock(const double sampleRate, const unsigned long long int startSample, const unsigned int blockSize, TCallback callback)
+{
+	if (!m_isPlaying || (blockSize == 0u))
+		return;
+
+	// play time is just past the time of the block's last sample so the events reported are those at or before it (later events are left for the next block).
+	// each event's offset is the first sample at or after the event's play time
+	const unsigned long long int endSample{ startSample + blockSize };
+	const double lastSampleTime{ static_cast<double>(endSample - 1u) / sampleRate };
+	updateToPlayTime(Duration(static_cast<long long int>(std::floor(lastSampleTime * 1e9)) + 1ll), true);
+	mergeWaitingEvents([this, &callback, sampleRate, startSample, endSample](const std::size_t trackIndex, const Event& event, const unsigned int pass)
 	{
-		if (m_currentPosition > Absorel{ m_lengthInSteps })
-		{
-			pause();
-			rewind();
-		}
-		else
-		{
-			double currentPlayClock = getPlayTime().asSeconds();
-			m_currentPosition = m_playbackStartingPosition + Absorel{ currentPlayClock * m_speed };
-			if (m_doAutomaticallyRemoveWaitingEventsOnNextUpdate)
-				resetEventsWaiting();
-			moveEventsInQueueBeforeCurrentPositionToWaiting();
-		}
-	}
+		const double eventSample{ std::ceil(playTimeFromPosition(event.position, pass == 0u).asSeconds() * sampleRate) };
+		unsigned long long int sample{ (eventSample > static_cast<double>(startSample)) ? static_cast<unsigned long long int>(eventSample) : startSample };
+		if (sample >= endSample)
+			sample = endSample - 1u;
+		callback(trackIndex, event, static_cast<unsigned int>(sample - startSample));
+	});
 }
 
 template <typename TData>
 inline void Yalpes<TData>::moveEventsInQueueBeforeCurrentPositionToWaiting()
 {
+	// events waiting are the range from the first event not yet removed up to the cursor so only the cursor needs to move.
+	// only the contiguous keys are scanned; events themselves are not touched
+	const unsigned long long int currentKey{ sortKeyFromPosition(m_currentPosition) };
 	for (auto& track : tracks)
 	{
-		unsigned int numberOfEventsToRemove{ 0u };
-
-		// copy to events waiting
-		for (auto& e : track.eventQueue)
-		{
-			if (e.position < m_currentPosition)
-			{
-				track.eventsWaiting.push_back(e);
-				numberOfEventsToRemove++;
-			}
-		}
-
-		// remove from events queue
-		if (numberOfEventsToRemove > 0)
-			track.eventQueue.erase(track.eventQueue.begin(), track.eventQueue.begin() + numberOfEventsToRemove);
+		const unsigned long long int* keys{ track.m_queueKeys.data() };
+		const std::size_t queueSize{ track.m_queueKeys.size() };
+		std::size_t cursor{ track.m_cursor };
+		while ((cursor < queueSize) && (keys[cursor] < currentKey))
+			++cursor;
+		track.m_cursor = cursor;
+		if (track.eventsWaiting.m_first > cursor)
+			track.eventsWaiting.m_first = cursor;
+		track.eventsWaiting.m_last = cursor;
 	}
 }
 
@@ -173,28 +272,96 @@ template <typename TData>
 inline void Yalpes<TData>::prepareEventQueue()
 {
 	unsigned int latestStep{ 0u };
-	resetEventsWaiting();
 	for (auto& track : tracks)
 	{
-		track.eventQueue.clear();
 		for (auto& e : track.events)
 		{
-			track.eventQueue.push_back(e);
 			if (latestStep < (e.position.absolute + e.position.relative))
-				latestStep = static_cast<int>(ceil(e.position.absolute + e.position.relative));
+				latestStep = stepsFromPosition(e.position);
 		}
-		orderEvents(track.eventQueue);
+		if (track.m_isActivated) // deactivated tracks keep an empty queue (as in play())
+			orderEvents(track);
 	}
-	moveEventsInQueueBeforeCurrentPositionToWaiting();
-	resetEventsWaiting();
+	placeCursors();
 	m_lengthInSteps = latestStep;
 }
 
+template <typename TData>
+inline void Yalpes<TData>::insertEvent(const std::size_t trackIndex, const Event& event)
+{
+	Track& track{ tracks[trackIndex] };
+	const bool isPrepared{ isEventQueuePrepared(track) };
+	if (isPrepared)
+		track.separateQueueFromEvents();
+	track.events.push_back(event);
+	if (isPrepared)
+		insertIntoEventQueue(track, track.events.size() - 1u);
+	const unsigned int steps{ stepsFromPosition(event.position) };
+	if (m_lengthInSteps < steps)
+		m_lengthInSteps = steps;
+}
+
+template <typename TData>
+inline void Yalpes<TData>::removeEvent(const std::size_t trackIndex, const std::size_t eventIndex)
+{
+	Track& track{ tracks[trackIndex] };
+	const Absorel position{ track.events[eventIndex].position };
+	if (isEventQueuePrepared(track))
+	{
+		track.separateQueueFromEvents();
+		eraseFromEventQueue(track, findInEventQueue(track, position, eventIndex));
+		for (auto& index : track.m_eventIndices)
+		{
+			if (index > eventIndex)
+				--index;
+		}
+	}
+	track.events.erase(track.events.begin() + eventIndex);
+	if (stepsFromPosition(position) >= m_lengthInSteps)
+		updateLengthInSteps();
+}
+
+template <typename TData>
+inline void Yalpes<TData>::moveEvent(const std::size_t trackIndex, const std::size_t eventIndex, const Absorel& position)
+{
+	Track& track{ tracks[trackIndex] };
+	const Absorel previousPosition{ track.events[eventIndex].position };
+	const bool isPrepared{ isEventQueuePrepared(track) };
+	if (isPrepared)
+	{
+		track.separateQueueFromEvents();
+		eraseFromEventQueue(track, findInEventQueue(track, previousPosition, eventIndex));
+	}
+	track.events[eventIndex].position = position;
+	if (isPrepared)
+		insertIntoEventQueue(track, eventIndex);
+	const unsigned int steps{ stepsFromPosition(position) };
+	if (m_lengthInSteps < steps)
+		m_lengthInSteps = steps;
+	else if (stepsFromPosition(previousPosition) >= m_lengthInSteps)
+		updateLengthInSteps();
+}
+
 template <typename TData>
 inline void Yalpes<TData>::play()
 {
 	m_playbackStartingPosition = m_currentPosition;
-	prepareEventQueue();
+	if (m_tempoMap != nullptr)
+		m_playbackStartingTime = m_tempoMap->getTime(m_playbackStartingPosition, m_tempoMapCursor);
+
+	// while live editing, only tracks whose events have been added to or removed from (other than by live editing) are prepared again
+	bool isAnyQueuePrepared{ false };
+	for (auto& track : tracks)
+	{
+		if (track.m_isActivated && (!m_isLiveEditingEnabled || !isEventQueuePrepared(track)))
+		{
+			orderEvents(track);
+			isAnyQueuePrepared = true;
+		}
+	}
+	if (isAnyQueuePrepared)
+		updateLengthInSteps();
+	placeCursors();
 	m_isPlaying = true;
 	m_playbackClock.restart();
 }
@@ -237,7 +404,8 @@ inline void Yalpes<TData>::seek(unsigned int positionAbsolute, double positionRe
 	}
 	m_currentPosition = { positionAbsolute, positionRelative };
 	m_playbackStartingPosition = m_currentPosition;
-	pause();
+	m_isPlaying = false;
+	placeCursors();
 }
 
 template <typename TData>
@@ -270,12 +438,42 @@ inline double Yalpes<TData>::getSpeed() const
 	return m_speed;
 }
 
+template <typename TData>
+inline const TempoMap* Yalpes<TData>::getTempoMap() const
+{
+	return m_tempoMap;
+}
+
 template <typename TData>
 inline unsigned int Yalpes<TData>::getSubsteps() const
 {
 	return m_substeps;
 }
 
+template <typename TData>
+inline bool Yalpes<TData>::isLoopEnabled() const
+{
+	return m_isLoopEnabled;
+}
+
+template <typename TData>
+inline bool Yalpes<TData>::isLiveEditingEnabled() const
+{
+	return m_isLiveEditingEnabled;
+}
+
+template <typename TData>
+inline Absorel Yalpes<TData>::getLoopStart() const
+{
+	return m_loopStart;
+}
+
+template <typename TData>
+inline Absorel Yalpes<TData>::getLoopEnd() const
+{
+	return m_loopEnd;
+}
+
 template <typename TData>
 inline unsigned int Yalpes<TData>::getNumberOfTracks() const
 {
@@ -288,13 +486,27 @@ inline unsigned int Yalpes<TData>::getNumberOfActiveTracks() const
 	unsigned int total{ 0u };
 	for (auto& track : tracks)
 	{
-		if (track.getActivated())
+		if (track.isActivated())
 			++total;
 	}
 	return total;
 }
 
 
+template <typename TData>
+template <typename TCallback>
+inline void Yalpes<TData>::forEachWaitingEvent(TCallback callback)
+{
+	mergeWaitingEvents([&callback](const std::size_t trackIndex, const Event& event, unsigned int) { callback(trackIndex, event); });
+}
+
+template <typename TData>
+template <typename TCallback>
+inline void Yalpes<TData>::forEachWaitingEventWithPlayTime(TCallback callback)
+{
+	mergeWaitingEvents([this, &callback](const std::size_t trackIndex, const Event& event, const unsigned int pass) { callback(trackIndex, event, playTimeFromPosition(event.position, pass == 0u)); });
+}
+
 template <typename TData>
 inline void Yalpes<TData>::setSpeed(double speed)
 {
@@ -304,12 +516,61 @@ inline void Yalpes<TData>::setSpeed(double speed)
 		m_speed = speed;
 }
 
+template <typename TData>
+inline void Yalpes<TData>::setTempoMap(const TempoMap* tempoMap)
+{
+	// playback continues from the current position
+	if (m_isPlaying)
+	{
+		m_playbackStartingPosition = m_currentPosition;
+		m_playbackClock.restart();
+	}
+	m_tempoMap = tempoMap;
+	m_tempoMapCursor = TempoMap::Cursor{};
+	if (m_tempoMap != nullptr)
+		m_playbackStartingTime = m_tempoMap->getTime(m_playbackStartingPosition, m_tempoMapCursor);
+}
+
 template <typename TData>
 inline void Yalpes<TData>::setSubsteps(unsigned int substeps)
 {
 	m_substeps = substeps;
 }
 
+template <typename TData>
+inline void Yalpes<TData>::setLoop(const Absorel& start, const Absorel& end)
+{
+	if (start < end)
+	{
+		m_loopStart = start;
+		m_loopEnd = end;
+	}
+}
+
+template <typename TData>
+inline void Yalpes<TData>::enableLoop()
+{
+	m_isLoopEnabled = (m_loopStart < m_loopEnd);
+}
+
+template <typename TData>
+inline void Yalpes<TData>::disableLoop()
+{
+	m_isLoopEnabled = false;
+}
+
+template <typename TData>
+inline void Yalpes<TData>::enableLiveEditing()
+{
+	m_isLiveEditingEnabled = true;
+}
+
+template <typename TData>
+inline void Yalpes<TData>::disableLiveEditing()
+{
+	m_isLiveEditingEnabled = false;
+}
+
 template <typename TData>
 inline std::string Yalpes<TData>::stringFromPosition(const Absorel& position) const
 {
@@ -331,16 +592,333 @@ inline void Yalpes<TData>::doNotAutomaticallyRemoveWaitingEventsOnNextUpdate()
 // PRIVATE
 
 template <typename TData>
-inline void Yalpes<TData>::orderEvents(std::vector<Event>& events)
+inline Absorel Yalpes<TData>::positionFromPlayTime(const Duration& playTime)
+{
+	if (m_tempoMap != nullptr)
+		return m_tempoMap->getPosition(m_playbackStartingTime + playTime, m_tempoMapCursor);
+	return m_playbackStartingPosition + Absorel{ playTime.asSeconds() * m_speed };
+}
+
+template <typename TData>
+template <typename TCallback>
+inline void Yalpes<TData>::mergeWaitingEvents(TCallback callback)
+{
+	// k-way merge using a min-heap of the next waiting event from each track.
+	// events from before the loop point (pass 0) come before events after it (pass 1) regardless of position
+	m_mergeHeap.clear();
+	const std::size_t numberOfTracks{ tracks.size() };
+	for (std::size_t trackIndex{ 0u }; trackIndex < numberOfTracks; ++trackIndex)
+	{
+		const Track& track{ tracks[trackIndex] };
+		if (!track.eventsWaiting.empty())
+			m_mergeHeap.push_back(getMergeEntry(trackIndex, 0u));
+	}
+
+	// a single track is already in order
+	if (m_mergeHeap.size() == 1u)
+	{
+		const std::size_t trackIndex{ m_mergeHeap.front().trackIndex };
+		const EventRange& eventsWaiting{ tracks[trackIndex].eventsWaiting };
+		const std::size_t previousSize{ eventsWaiting.getPreviousSize() };
+		const std::size_t size{ eventsWaiting.size() };
+		for (std::size_t i{ 0u }; i < size; ++i)
+			callback(trackIndex, eventsWaiting[i], (i < previousSize) ? 0u : 1u);
+		return;
+	}
+
+	const std::greater<MergeEntry> isLater;
+	std::make_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+	while (!m_mergeHeap.empty())
+	{
+		std::pop_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+		MergeEntry& entry(m_mergeHeap.back());
+		const EventRange& eventsWaiting{ tracks[entry.trackIndex].eventsWaiting };
+		callback(entry.trackIndex, eventsWaiting[entry.index], entry.pass);
+		if (entry.index + 1u < eventsWaiting.size())
+		{
+			entry = getMergeEntry(entry.trackIndex, entry.index + 1u);
+			std::push_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+		}
+		else
+			m_mergeHeap.pop_back();
+	}
+}
+
+template <typename TData>
+inline void Yalpes<TData>::updateToPlayTime(const Duration& playTime, const bool doRemoveWaitingEvents)
+{
+	if (!m_isLoopEnabled && (m_currentPosition > Absorel{ m_lengthInSteps }))
+	{
+		pause();
+		rewind();
+		return;
+	}
+
+	m_currentPosition = positionFromPlayTime(playTime);
+	if (doRemoveWaitingEvents)
+		resetEventsWaiting();
+	while (m_isLoopEnabled && !(m_currentPosition < m_loopEnd))
+	{
+		wrapLoop(playTime);
+		m_currentPosition = positionFromPlayTime(playTime);
+	}
+	moveEventsInQueueBeforeCurrentPositionToWaiting();
+}
+
+template <typename TData>
+inline void Yalpes<TData>::wrapLoop(const Duration& playTime)
+{
+	// events up to the loop end become the first part of the events waiting and then cursors jump back to the loop start.
+	// (if events waiting are not removed, only the events since the previous loop point are kept)
+	const Absorel position{ m_currentPosition };
+	m_previousPlaybackStartingPosition = m_playbackStartingPosition;
+	m_previousPlaybackStartingTime = m_playbackStartingTime;
+	m_currentPosition = m_loopEnd;
+	moveEventsInQueueBeforeCurrentPositionToWaiting();
+	const unsigned long long int loopStartKey{ sortKeyFromPosition(m_loopStart) };
+	for (auto& track : tracks)
+	{
+		EventRange& eventsWaiting{ track.eventsWaiting };
+		eventsWaiting.m_previousFirst = eventsWaiting.m_first;
+		eventsWaiting.m_previousLast = eventsWaiting.m_last;
+		track.m_cursor = static_cast<std::size_t>(std::lower_bound(track.m_queueKeys.begin(), track.m_queueKeys.end(), loopStartKey) - track.m_queueKeys.begin());
+		eventsWaiting.m_first = track.m_cursor;
+		eventsWaiting.m_last = track.m_cursor;
+	}
+
+	// playback start is moved back by a whole number of loops so that the play time maps to a position inside the loop (whole loops skipped in a single update are not dispatched)
+	if (m_tempoMap != nullptr)
+	{
+		const Duration loopEndTime{ m_tempoMap->getTime(m_loopEnd) };
+		const long long int loopDuration{ (loopEndTime - m_tempoMap->getTime(m_loopStart)).nano };
+		const long long int numberOfLoops{ 1ll + ((m_playbackStartingTime + playTime) - loopEndTime).nano / loopDuration };
+		m_playbackStartingTime = m_playbackStartingTime - Duration(loopDuration * numberOfLoops);
+	}
+	else
+	{
+		const double loopLength{ (m_loopEnd.absolute + m_loopEnd.relative) - (m_loopStart.absolute + m_loopStart.relative) };
+		const double overshoot{ (position.absolute + position.relative) - (m_loopEnd.absolute + m_loopEnd.relative) };
+		m_playbackStartingPosition = m_playbackStartingPosition - Absorel{ loopLength * (1.0 + std::floor(overshoot / loopLength)) };
+	}
+}
+
+template <typename TData>
+inline Duration Yalpes<TData>::playTimeFromPosition(const Absorel& position, const bool isBeforeLoopPoint) const
 {
-	std::sort(events.begin(), events.end());
+	// events passed before the loop point were reached with the playback start from before the loop wrapped
+	if (m_tempoMap != nullptr)
+		return m_tempoMap->getTime(position) - (isBeforeLoopPoint ? m_previousPlaybackStartingTime : m_playbackStartingTime);
+	const Absorel& startingPosition(isBeforeLoopPoint ? m_previousPlaybackStartingPosition : m_playbackStartingPosition);
+	return Duration(((position.absolute + position.relative) - (startingPosition.absolute + startingPosition.relative)) / m_speed);
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::MergeEntry Yalpes<TData>::getMergeEntry(const std::size_t trackIndex, const std::size_t index) const
+{
+	const Track& track{ tracks[trackIndex] };
+	const EventRange& eventsWaiting{ track.eventsWaiting };
+	return{ (index < eventsWaiting.getPreviousSize()) ? 0u : 1u, track.m_queueKeys[eventsWaiting.getQueueIndex(index)], trackIndex, index };
+}
+
+template <typename TData>
+inline void Yalpes<TData>::orderEvents(Track& track)
+{
+	// LSD radix sort of (fixed-point key, event index) pairs followed by a single permutation into the queue.
+	// the sort is stable so events with equal positions keep the order they have in events (queue order is (key, event index))
+	const std::vector<Event>& events{ track.events };
+	const std::size_t numberOfEvents{ events.size() };
+	std::vector<std::size_t>& indices{ track.m_eventIndices };
+	m_sortKeys.resize(numberOfEvents);
+	m_sortKeysBuffer.resize(numberOfEvents);
+	indices.resize(numberOfEvents);
+	m_sortIndicesBuffer.resize(numberOfEvents);
+
+	std::size_t counts[8u][256u] = {};
+	bool isSorted{ true };
+	for (std::size_t i{ 0u }; i < numberOfEvents; ++i)
+	{
+		const unsigned long long int key{ sortKeyFromPosition(events[i].position) };
+		if ((i > 0u) && (key < m_sortKeys[i - 1u]))
+			isSorted = false;
+		m_sortKeys[i] = key;
+		indices[i] = i;
+		for (unsigned int byte{ 0u }; byte < 8u; ++byte)
+			++counts[byte][(key >> (byte * 8u)) & 0xFFu];
+	}
+
+	// events that are already in order (e.g. loaded from a song file) are not sorted
+	for (unsigned int byte{ 0u }; (byte < 8u) && !isSorted; ++byte)
+	{
+		std::size_t* byteCounts{ counts[byte] };
+		if (byteCounts[(m_sortKeys[0u] >> (byte * 8u)) & 0xFFu] == numberOfEvents)
+			continue; // every key has the same value for this byte so this pass would not change the order
+
+		std::size_t offset{ 0u };
+		for (std::size_t value{ 0u }; value < 256u; ++value)
+		{
+			const std::size_t count{ byteCounts[value] };
+			byteCounts[value] = offset;
+			offset += count;
+		}
+		for (std::size_t i{ 0u }; i < numberOfEvents; ++i)
+		{
+			const std::size_t destination{ byteCounts[(m_sortKeys[i] >> (byte * 8u)) & 0xFFu]++ };
+			m_sortKeysBuffer[destination] = m_sortKeys[i];
+			m_sortIndicesBuffer[destination] = indices[i];
+		}
+		m_sortKeys.swap(m_sortKeysBuffer);
+		indices.swap(m_sortIndicesBuffer);
+	}
+
+	if (isSorted)
+		track.setQueueInEvents(true); // events are used as the queue (not copied)
+	else
+	{
+		track.setQueueInEvents(false);
+		track.eventQueue.clear();
+		track.eventQueue.reserve(numberOfEvents);
+		for (auto& index : indices)
+			track.eventQueue.push_back(events[index]);
+	}
+	track.m_queueKeys.swap(m_sortKeys); // sorted keys become the track's queue keys
+}
+
+template <typename TData>
+inline bool Yalpes<TData>::isEventQueuePrepared(const Track& track) const
+{
+	// deactivated tracks have their queue cleared and are not prepared until prepareEventQueue
+	const std::size_t numberOfEvents{ track.events.size() };
+	return track.m_isActivated && (track.getQueue().size() == numberOfEvents) && (track.m_eventIndices.size() == numberOfEvents) && (track.m_queueKeys.size() == numberOfEvents);
+}
+
+template <typename TData>
+inline std::size_t Yalpes<TData>::findInEventQueue(const Track& track, const Absorel& position, const std::size_t eventIndex) const
+{
+	// lower bound of (key, event index) in the queue (the same order as orderEvents)
+	const unsigned long long int key{ sortKeyFromPosition(position) };
+	std::size_t first{ 0u };
+	std::size_t count{ track.m_queueKeys.size() };
+	while (count > 0u)
+	{
+		const std::size_t step{ count / 2u };
+		const std::size_t middle{ first + step };
+		const unsigned long long int middleKey{ track.m_queueKeys[middle] };
+		if ((middleKey < key) || ((middleKey == key) && (track.m_eventIndices[middle] < eventIndex)))
+		{
+			first = middle + 1u;
+			count -= step + 1u;
+		}
+		else
+			count = step;
+	}
+	return first;
+}
+
+template <typename TData>
+inline void Yalpes<TData>::insertIntoEventQueue(Track& track, const std::size_t eventIndex)
+{
+	const Event& event{ track.events[eventIndex] };
+	const std::size_t queueIndex{ findInEventQueue(track, event.position, eventIndex) };
+	track.eventQueue.insert(track.eventQueue.begin() + queueIndex, event);
+	track.m_eventIndices.insert(track.m_eventIndices.begin() + queueIndex, eventIndex);
+	track.m_queueKeys.insert(track.m_queueKeys.begin() + queueIndex, sortKeyFromPosition(event.position));
+
+	// events inserted before the cursor (or at the cursor but before the current position) have already been passed so are never dispatched.
+	// (only an event inserted in between events currently waiting becomes part of the waiting range)
+	EventRange& eventsWaiting{ track.eventsWaiting };
+	if ((queueIndex < track.m_cursor) || ((queueIndex == track.m_cursor) && (track.m_queueKeys[queueIndex] < sortKeyFromPosition(m_currentPosition))))
+	{
+		++track.m_cursor;
+		if (queueIndex <= eventsWaiting.m_first)
+			++eventsWaiting.m_first;
+	}
+	eventsWaiting.m_last = track.m_cursor;
+	if (eventsWaiting.m_previousFirst != eventsWaiting.m_previousLast)
+	{
+		if (queueIndex <= eventsWaiting.m_previousFirst)
+		{
+			++eventsWaiting.m_previousFirst;
+			++eventsWaiting.m_previousLast;
+		}
+		else if (queueIndex < eventsWaiting.m_previousLast)
+			++eventsWaiting.m_previousLast;
+	}
+}
+
+template <typename TData>
+inline void Yalpes<TData>::eraseFromEventQueue(Track& track, const std::size_t queueIndex)
+{
+	track.eventQueue.erase(track.eventQueue.begin() + queueIndex);
+	track.m_eventIndices.erase(track.m_eventIndices.begin() + queueIndex);
+	track.m_queueKeys.erase(track.m_queueKeys.begin() + queueIndex);
+	EventRange& eventsWaiting{ track.eventsWaiting };
+	if (queueIndex < track.m_cursor)
+	{
+		--track.m_cursor;
+		if (queueIndex < eventsWaiting.m_first)
+			--eventsWaiting.m_first;
+	}
+	eventsWaiting.m_last = track.m_cursor;
+	if (queueIndex < eventsWaiting.m_previousFirst)
+	{
+		--eventsWaiting.m_previousFirst;
+		--eventsWaiting.m_previousLast;
+	}
+	else if (queueIndex < eventsWaiting.m_previousLast)
+		--eventsWaiting.m_previousLast;
+}
+
+template <typename TData>
+inline void Yalpes<TData>::updateLengthInSteps()
+{
+	// the last event of a prepared queue is the latest so only unprepared tracks need their events scanned
+	unsigned int latestStep{ 0u };
+	for (auto& track : tracks)
+	{
+		if (isEventQueuePrepared(track))
+		{
+			if (!track.getQueue().empty())
+				latestStep = std::max(latestStep, stepsFromPosition(track.getQueue().back().position));
+		}
+		else
+		{
+			for (auto& e : track.events)
+				latestStep = std::max(latestStep, stepsFromPosition(e.position));
+		}
+	}
+	m_lengthInSteps = latestStep;
+}
+
+template <typename TData>
+inline unsigned int Yalpes<TData>::stepsFromPosition(const Absorel& position) const
+{
+	return static_cast<unsigned int>(std::ceil(position.absolute + position.relative));
+}
+
+template <typename TData>
+inline unsigned long long int Yalpes<TData>::sortKeyFromPosition(const Absorel& position)
+{
+	// 32.32 fixed-point position with the sign bit flipped so that unsigned order matches signed order
+	return static_cast<unsigned long long int>(FixedAbsorel(position).value) ^ (1ull << 63u);
+}
+
+template <typename TData>
+inline void Yalpes<TData>::placeCursors()
+{
+	// binary search of each track's sorted keys so seeking is independent of the distance moved (forwards or backwards)
+	const unsigned long long int currentKey{ sortKeyFromPosition(m_currentPosition) };
+	for (auto& track : tracks)
+	{
+		track.m_cursor = static_cast<std::size_t>(std::lower_bound(track.m_queueKeys.begin(), track.m_queueKeys.end(), currentKey) - track.m_queueKeys.begin());
+		track.eventsWaiting.reset(track.m_cursor);
+	}
 }
 
 template <typename TData>
 inline void Yalpes<TData>::resetEventsWaiting()
 {
 	for (auto& track : tracks)
-		track.eventsWaiting.clear();
+		track.eventsWaiting.reset(track.m_cursor);
 }
 
 template <typename TData>
@@ -382,6 +960,67 @@ inline std::string Yalpes<TData>::stringFromPositionWithSubsteps(const Absorel&
 template <typename TData>
 inline Yalpes<TData>::Track::Track()
 {
+	eventsWaiting.m_events = &eventQueue;
+}
+
+// copying and moving keeps the events waiting range referring to the track's own queue
+
+template <typename TData>
+inline Yalpes<TData>::Track::Track(const Track& track)
+	: events(track.events)
+	, eventQueue(track.eventQueue)
+	, eventsWaiting(track.eventsWaiting)
+	, m_isActivated(track.m_isActivated)
+	, m_cursor(track.m_cursor)
+	, m_eventIndices(track.m_eventIndices)
+	, m_queueKeys(track.m_queueKeys)
+	, m_isQueueInEvents(track.m_isQueueInEvents)
+{
+	eventsWaiting.m_events = &getQueue();
+}
+
+template <typename TData>
+inline Yalpes<TData>::Track::Track(Track&& track) noexcept
+	: events(std::move(track.events))
+	, eventQueue(std::move(track.eventQueue))
+	, eventsWaiting(track.eventsWaiting)
+	, m_isActivated(track.m_isActivated)
+	, m_cursor(track.m_cursor)
+	, m_eventIndices(std::move(track.m_eventIndices))
+	, m_queueKeys(std::move(track.m_queueKeys))
+	, m_isQueueInEvents(track.m_isQueueInEvents)
+{
+	eventsWaiting.m_events = &getQueue();
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::Track& Yalpes<TData>::Track::operator=(const Track& track)
+{
+	events = track.events;
+	eventQueue = track.eventQueue;
+	eventsWaiting = track.eventsWaiting;
+	m_isActivated = track.m_isActivated;
+	m_cursor = track.m_cursor;
+	m_eventIndices = track.m_eventIndices;
+	m_queueKeys = track.m_queueKeys;
+	m_isQueueInEvents = track.m_isQueueInEvents;
+	eventsWaiting.m_events = &getQueue();
+	return *this;
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::Track& Yalpes<TData>::Track::operator=(Track&& track) noexcept
+{
+	events = std::move(track.events);
+	eventQueue = std::move(track.eventQueue);
+	eventsWaiting = track.eventsWaiting;
+	m_isActivated = track.m_isActivated;
+	m_cursor = track.m_cursor;
+	m_eventIndices = std::move(track.m_eventIndices);
+	m_queueKeys = std::move(track.m_queueKeys);
+	m_isQueueInEvents = track.m_isQueueInEvents;
+	eventsWaiting.m_events = &getQueue();
+	return *this;
 }
 
 template <typename TData>
@@ -410,11 +1049,193 @@ inline void Yalpes<TData>::Track::setActivated(bool isActivated)
 	m_isActivated = isActivated;
 	if (!m_isActivated)
 	{
+		setQueueInEvents(false);
 		eventQueue.clear();
-		eventsWaiting.clear();
+		m_eventIndices.clear();
+		m_queueKeys.clear();
+		m_cursor = 0u;
+		eventsWaiting.reset(0u);
 	}
 }
 
+template <typename TData>
+inline void Yalpes<TData>::Track::setQueueInEvents(const bool isQueueInEvents)
+{
+	m_isQueueInEvents = isQueueInEvents;
+	if (m_isQueueInEvents)
+		std::vector<Event>().swap(eventQueue); // releases the copy's memory
+	eventsWaiting.m_events = &getQueue();
+}
+
+template <typename TData>
+inline void Yalpes<TData>::Track::separateQueueFromEvents()
+{
+	// live edits change events and the queue separately so the queue must be its own copy
+	if (!m_isQueueInEvents)
+		return;
+	eventQueue = events;
+	setQueueInEvents(false);
+}
+
+template <typename TData>
+inline const std::vector<typename Yalpes<TData>::Event>& Yalpes<TData>::Track::getQueue() const
+{
+	return m_isQueueInEvents ? events : eventQueue;
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************
+*                                              *
+*  YALPES EVENT RANGE TEMPLATE IMPLEMENTATION  *
+*                                              *
+***********************************************/
+
+template <typename TData>
+inline Yalpes<TData>::EventRange::EventRange()
+{
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::EventRange::Iterator Yalpes<TData>::EventRange::begin() const
+{
+	return Iterator(*this, 0u);
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::EventRange::Iterator Yalpes<TData>::EventRange::end() const
+{
+	return Iterator(*this, size());
+}
+
+template <typename TData>
+inline std::size_t Yalpes<TData>::EventRange::size() const
+{
+	return getPreviousSize() + (m_last - m_first);
+}
+
+template <typename TData>
+inline bool Yalpes<TData>::EventRange::empty() const
+{
+	return size() == 0u;
+}
+
+template <typename TData>
+inline const typename Yalpes<TData>::Event& Yalpes<TData>::EventRange::operator[](const std::size_t index) const
+{
+	return (*m_events)[getQueueIndex(index)];
+}
+
+template <typename TData>
+inline const typename Yalpes<TData>::Event& Yalpes<TData>::EventRange::front() const
+{
+	return (*this)[0u];
+}
+
+template <typename TData>
+inline const typename Yalpes<TData>::Event& Yalpes<TData>::EventRange::back() const
+{
+	return (*this)[size() - 1u];
+}
+
+template <typename TData>
+inline void Yalpes<TData>::EventRange::clear()
+{
+	reset(m_last);
+}
+
+// PRIVATE
+
+template <typename TData>
+inline std::size_t Yalpes<TData>::EventRange::getPreviousSize() const
+{
+	return m_previousLast - m_previousFirst;
+}
+
+template <typename TData>
+inline std::size_t Yalpes<TData>::EventRange::getQueueIndex(const std::size_t index) const
+{
+	const std::size_t previousSize{ getPreviousSize() };
+	return (index < previousSize) ? m_previousFirst + index : m_first + (index - previousSize);
+}
+
+template <typename TData>
+inline void Yalpes<TData>::EventRange::reset(const std::size_t queueIndex)
+{
+	m_previousFirst = 0u;
+	m_previousLast = 0u;
+	m_first = queueIndex;
+	m_last = queueIndex;
+}
+
+
+
+template <typename TData>
+inline Yalpes<TData>::EventRange::Iterator::Iterator(const EventRange& range, const std::size_t index)
+	: m_range(&range)
+	, m_index(index)
+{
+}
+
+template <typename TData>
+inline const typename Yalpes<TData>::Event& Yalpes<TData>::EventRange::Iterator::operator*() const
+{
+	return (*m_range)[m_index];
+}
+
+template <typename TData>
+inline const typename Yalpes<TData>::Event* Yalpes<TData>::EventRange::Iterator::operator->() const
+{
+	return &(*m_range)[m_index];
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::EventRange::Iterator& Yalpes<TData>::EventRange::Iterator::operator++()
+{
+	++m_index;
+	return *this;
+}
+
+template <typename TData>
+inline typename Yalpes<TData>::EventRange::Iterator Yalpes<TData>::EventRange::Iterator::operator++(int)
+{
+	Iterator iterator(*this);
+	++m_index;
+	return iterator;
+}
+
+template <typename TData>
+inline bool Yalpes<TData>::EventRange::Iterator::operator==(const Iterator& iterator) const
+{
+	return (m_range == iterator.m_range) && (m_index == iterator.m_index);
+}
+
+template <typename TData>
+inline bool Yalpes<TData>::EventRange::Iterator::operator!=(const Iterator& iterator) const
+{
+	return !(*this == iterator);
+}
+
 
 
 
@@ -455,5 +1276,41 @@ inline bool Yalpes<TData>::Event::operator>(const Event& e) const
 	return (position.absolute + position.relative) > (e.position.absolute + e.position.relative);
 }
 
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+/***********************************************
+*                                              *
+*  YALPES MERGE ENTRY TEMPLATE IMPLEMENTATION  *
+*                                              *
+***********************************************/
+
+template <typename TData>
+inline bool Yalpes<TData>::MergeEntry::operator>(const MergeEntry& entry) const
+{
+	if (pass != entry.pass)
+		return pass > entry.pass;
+	return (key > entry.key) || ((key == entry.key) && (trackIndex > entry.trackIndex));
+}
+
 } // namespace kairos
 #endif // KAIROS_YALPES_INL
@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// YalpesSequencer
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+// WARNING: C++11 or later required (uses <thread> and <atomic>)
+
+// Runs Yalpes playback on its own thread and passes dispatched events to consumer threads through lock-free queues
+
+// every update period, the sequencer thread updates the Yalpes to the play time plus the lookahead and pushes each waiting
+// event (in position order across tracks) to every consumer's queue, stamped with the steady clock time (see ClockMapper::now())
+// at which it is due. with a lookahead of at least the update period, events are passed before they are due so consumers
+// can schedule them at their stamped time (plus any fixed latency), independently of their frame rate.
+
+// while running, the Yalpes must only be accessed through execute() (commands run on the sequencer thread).
+// waiting events are removed automatically on every update so each event is passed only once.
+
+#ifndef KAIROS_YALPESSEQUENCER_HPP
+#define KAIROS_YALPESSEQUENCER_HPP
+
+#include "Yalpes.hpp"
+#include "SpscQueue.hpp"
+#include "Duration.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace kairos
+{
+
+template <typename TData>
+class YalpesSequencer
+{
+public:
+	typedef typename Yalpes<TData>::Event Event;
+	typedef std::function<void(Yalpes<TData>&)> Command;
+
+	struct SequencedEvent
+	{
+		std::size_t trackIndex;
+		Event event;
+		Duration time; // steady clock time at which the event is due (see ClockMapper::now()). up to the lookahead in the future
+	};
+
+	explicit YalpesSequencer(Yalpes<TData>& yalpes, std::size_t numberOfConsumers = 1u, std::size_t queueCapacity = 1024u);
+	YalpesSequencer(const YalpesSequencer&) = delete;
+	YalpesSequencer& operator=(const YalpesSequencer&) = delete;
+	~YalpesSequencer(); // stops the thread
+
+	void start();
+	void stop(); // waits for the thread to finish
+	bool isRunning() const;
+	void setUpdatePeriod(Duration updatePeriod); // takes effect when started
+	Duration getUpdatePeriod() const;
+	void setLookahead(Duration lookahead); // how far ahead of their due time events are passed. takes effect when started
+	Duration getLookahead() const;
+	std::thread::native_handle_type getNativeHandle(); // e.g. to raise the thread's priority (platform-specific). only valid while running
+
+	bool execute(Command command); // runs command on the sequencer thread before its next update. returns false if too many commands are pending (only one thread may execute commands)
+
+	// consumers (only one thread may pop from each consumer's queue)
+	bool pop(std::size_t consumerIndex, SequencedEvent& sequencedEvent);
+	std::size_t getNumberOfConsumers() const;
+	unsigned long long int getNumberOfDroppedEvents() const; // events not passed to a consumer because its queue was full
+
+private:
+	Yalpes<TData>& m_yalpes;
+	std::vector<std::unique_ptr<SpscQueue<SequencedEvent>>> m_queues; // (queues contain atomics so cannot be stored directly)
+	SpscQueue<Command> m_commands;
+	Duration m_updatePeriod;
+	Duration m_lookahead;
+	std::atomic<bool> m_isRunning;
+	std::atomic<unsigned long long int> m_numberOfDroppedEvents;
+	std::thread m_thread;
+
+	void priv_run();
+};
+
+} // namespace kairos
+
+#include "YalpesSequencer.inl"
+#endif // KAIROS_YALPESSEQUENCER_HPP
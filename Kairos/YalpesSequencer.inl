@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// YalpesSequencer
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef KAIROS_YALPESSEQUENCER_INL
+#define KAIROS_YALPESSEQUENCER_INL
+
+#include "YalpesSequencer.hpp"
+
+#include "ClockMapper.hpp"
+#include "FrameLimiter.hpp"
+
+namespace kairos
+{
+
+template <typename TData>
+inline YalpesSequencer<TData>::YalpesSequencer(Yalpes<TData>& yalpes, const std::size_t numberOfConsumers, const std::size_t queueCapacity)
+	: m_yalpes(yalpes)
+	, m_queues()
+	, m_commands(64u)
+	, m_updatePeriod(5) // 5 ms (long enough for the frame limiter to sleep for most of it)
+	, m_lookahead(10)
+	, m_isRunning(false)
+	, m_numberOfDroppedEvents(0ull)
+	, m_thread()
+{
+	for (std::size_t i{ 0u }; i < numberOfConsumers; ++i)
+		m_queues.emplace_back(new SpscQueue<SequencedEvent>(queueCapacity));
+}
+
+template <typename TData>
+inline YalpesSequencer<TData>::~YalpesSequencer()
+{
+	stop();
+}
+
+template <typename TData>
+inline void YalpesSequencer<TData>::start()
+{
+	if (m_isRunning.load(std::memory_order_acquire))
+		return;
+	m_yalpes.automaticallyRemoveWaitingEventsOnNextUpdate();
+	m_isRunning.store(true, std::memory_order_release);
+	m_thread = std::thread(&YalpesSequencer::priv_run, this);
+}
+
+template <typename TData>
+inline void YalpesSequencer<TData>::stop()
+{
+	m_isRunning.store(false, std::memory_order_release);
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+template <typename TData>
+inline bool YalpesSequencer<TData>::isRunning() const
+{
+	return m_isRunning.load(std::memory_order_acquire);
+}
+
+template <typename TData>
+inline void YalpesSequencer<TData>::setUpdatePeriod(const Duration updatePeriod)
+{
+	m_updatePeriod = updatePeriod;
+}
+
+template <typename TData>
+inline Duration YalpesSequencer<TData>::getUpdatePeriod() const
+{
+	return m_updatePeriod;
+}
+
+template <typename TData>
+inline void YalpesSequencer<TData>::setLookahead(const Duration lookahead)
+{
+	m_lookahead = lookahead;
+}
+
+template <typename TData>
+inline Duration YalpesSequencer<TData>::getLookahead() const
+{
+	return m_lookahead;
+}
+
+template <typename TData>
+inline std::thread::native_handle_type YalpesSequencer<TData>::getNativeHandle()
+{
+	return m_thread.native_handle();
+}
+
+template <typename TData>
+inline bool YalpesSequencer<TData>::execute(Command command)
+{
+	return m_commands.push(std::move(command));
+}
+
+template <typename TData>
+inline bool YalpesSequencer<TData>::pop(const std::size_t consumerIndex, SequencedEvent& sequencedEvent)
+{
+	return m_queues[consumerIndex]->pop(sequencedEvent);
+}
+
+template <typename TData>
+inline std::size_t YalpesSequencer<TData>::getNumberOfConsumers() const
+{
+	return m_queues.size();
+}
+
+template <typename TData>
+inline unsigned long long int YalpesSequencer<TData>::getNumberOfDroppedEvents() const
+{
+	return m_numberOfDroppedEvents.load(std::memory_order_relaxed);
+}
+
+// PRIVATE
+
+template <typename TData>
+inline void YalpesSequencer<TData>::priv_run()
+{
+	FrameLimiter frameLimiter;
+	frameLimiter.setFramePeriod(m_updatePeriod);
+	const Duration lookahead{ m_lookahead };
+	Command command;
+	while (m_isRunning.load(std::memory_order_acquire))
+	{
+		// commands are moved out of the queue (not copied) so running them does not allocate
+		while (m_commands.pop(command))
+		{
+			command(m_yalpes);
+			command = nullptr;
+		}
+
+		m_yalpes.update(lookahead);
+
+		// event's due time is its play time's offset from the current play time, applied to the current steady clock time
+		const Duration now{ ClockMapper::now() };
+		const Duration playTime{ m_yalpes.getPlayTime() };
+		m_yalpes.forEachWaitingEventWithPlayTime([this, &now, &playTime](const std::size_t trackIndex, const Event& event, const Duration& eventPlayTime)
+		{
+			const SequencedEvent sequencedEvent{ trackIndex, event, now - (playTime - eventPlayTime) };
+			for (auto& queue : m_queues)
+			{
+				if (!queue->push(sequencedEvent))
+					m_numberOfDroppedEvents.fetch_add(1ull, std::memory_order_relaxed);
+			}
+		});
+
+		frameLimiter.wait();
+	}
+}
+
+} // namespace kairos
+#endif // KAIROS_YALPESSEQUENCER_INL
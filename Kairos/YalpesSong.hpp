@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// YalpesSong
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+// WARNING: C++11 or later required
+
+// Versioned binary song format for Yalpes, memory-mapped for loading
+
+// each track is stored pre-sorted as three arrays: positions (32.32 fixed-point, see FixedAbsorel), types and payloads.
+// a song file is opened by memory-mapping it; the arrays can then be read directly from the mapped pages without parsing.
+// load() fills a Yalpes' tracks' events from the mapped arrays. since the events are already in order, they are used as the
+// event queue without being copied or sorted (preparing the queue again only checks their order).
+
+// TData must be trivially copyable (payloads are stored as their bytes) and the file stores values little-endian;
+// open() fails on big-endian systems.
+
+// this header includes platform headers for memory-mapping (<windows.h> or POSIX headers) so it is not included by Kairos/all.hpp
+// and must be included directly. (<windows.h> is included lean; include it before this header if its full API is needed)
+
+// file layout (all values little-endian, arrays aligned to 8 bytes):
+// header (16 bytes): "KYLS", version (1 byte), 3 bytes padding, payload size (4 bytes), number of tracks (4 bytes)
+// track table (24 bytes per track): number of events (8 bytes), offset of track's arrays from start of file (8 bytes), flags (8 bytes; bit 0 is activated)
+// each track: positions (8 bytes per event), types (4 bytes per event, padded to 8), payloads (payload size per event, padded to 8)
+
+#ifndef KAIROS_YALPESSONG_HPP
+#define KAIROS_YALPESSONG_HPP
+
+#include "Yalpes.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace kairos
+{
+
+template <typename TData>
+class YalpesSong
+{
+	static_assert(std::is_trivially_copyable<TData>::value, "TData must be trivially copyable to be stored in a song");
+	static_assert(alignof(TData) <= 8u, "TData must not need more than 8-byte alignment to be read from a song");
+
+public:
+	YalpesSong();
+	YalpesSong(const YalpesSong&) = delete;
+	YalpesSong& operator=(const YalpesSong&) = delete;
+	~YalpesSong(); // closes the file
+
+	static bool save(const Yalpes<TData>& yalpes, std::ostream& stream); // streams each track in order (without building the file in memory). stream must be binary
+
+	bool open(const std::string& filename); // memory-maps the file. returns false (and leaves the song closed) if it is not a valid song for TData
+	void close();
+	bool isOpen() const;
+
+	std::size_t getNumberOfTracks() const;
+	std::size_t getNumberOfEvents(std::size_t trackIndex) const;
+	bool isTrackActivated(std::size_t trackIndex) const;
+	const long long int* getPositions(std::size_t trackIndex) const; // in order. FixedAbsorel values (see FixedAbsorel::fromValue)
+	const unsigned int* getTypes(std::size_t trackIndex) const;
+	const TData* getData(std::size_t trackIndex) const;
+
+	void load(Yalpes<TData>& yalpes) const; // replaces yalpes' tracks with the song's tracks
+
+private:
+	const unsigned char* m_data;
+	std::size_t m_size;
+
+	static typename Yalpes<TData>::Event priv_getEvent(long long int position, unsigned int type, const TData& data);
+	std::size_t priv_getTrackTableOffset(std::size_t trackIndex) const;
+	std::size_t priv_getTrackOffset(std::size_t trackIndex) const;
+	unsigned long long int priv_read(std::size_t offset, unsigned int numberOfBytes) const;
+	static void priv_write(std::ostream& stream, unsigned long long int value, unsigned int numberOfBytes);
+	static void priv_writePadding(std::ostream& stream, std::size_t size);
+	static std::size_t priv_getPaddedSize(std::size_t size);
+	static std::size_t priv_getTrackSize(std::size_t numberOfEvents);
+};
+
+} // namespace kairos
+
+#include "YalpesSong.inl"
+#endif // KAIROS_YALPESSONG_HPP
@@ -0,0 +1,368 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// Kairos
+// --
+//
+// YalpesSong
+//
+// Copyright(c) 2026 M.J.Silk
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions :
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software.If you use this software
+// in a product, an acknowledgment in the product documentation would be
+// appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+// M.J.Silk
+// MJSilk2@gmail.com
+//
+//////////////////////////////////////////////////////////////////////////////
+#ifndef KAIROS_YALPESSONG_INL
+#define KAIROS_YALPESSONG_INL
+
+#include "YalpesSong.hpp"
+
+#include <algorithm> // for std::stable_sort and std::is_sorted
+#include <cstring> // for std::memcmp
+#include <vector>
+
+// macros defined here are undefined again after <windows.h> so they do not affect the including code
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define KAIROS_YALPESSONG_DEFINED_WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#define KAIROS_YALPESSONG_DEFINED_NOMINMAX
+#endif // NOMINMAX
+#include <windows.h>
+#ifdef KAIROS_YALPESSONG_DEFINED_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef KAIROS_YALPESSONG_DEFINED_WIN32_LEAN_AND_MEAN
+#endif // KAIROS_YALPESSONG_DEFINED_WIN32_LEAN_AND_MEAN
+#ifdef KAIROS_YALPESSONG_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef KAIROS_YALPESSONG_DEFINED_NOMINMAX
+#endif // KAIROS_YALPESSONG_DEFINED_NOMINMAX
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace kairos
+{
+
+namespace priv
+{
+
+const char yalpesSongMagic[4]{ 'K', 'Y', 'L', 'S' };
+const unsigned char yalpesSongVersion{ 1u };
+const std::size_t yalpesSongHeaderSize{ 16u };
+const std::size_t yalpesSongTrackTableEntrySize{ 24u };
+const unsigned long long int yalpesSongActivatedFlag{ 1u };
+
+} // namespace priv
+
+template <typename TData>
+inline YalpesSong<TData>::YalpesSong()
+	: m_data(nullptr)
+	, m_size(0u)
+{
+}
+
+template <typename TData>
+inline YalpesSong<TData>::~YalpesSong()
+{
+	close();
+}
+
+template <typename TData>
+inline bool YalpesSong<TData>::save(const Yalpes<TData>& yalpes, std::ostream& stream)
+{
+	const std::size_t numberOfTracks{ yalpes.tracks.size() };
+	stream.write(priv::yalpesSongMagic, 4);
+	stream.put(static_cast<char>(priv::yalpesSongVersion));
+	priv_writePadding(stream, 3u);
+	priv_write(stream, sizeof(TData), 4u);
+	priv_write(stream, numberOfTracks, 4u);
+
+	// offsets of all tracks are known from their sizes so the table can be written first
+	std::size_t offset{ priv::yalpesSongHeaderSize + priv::yalpesSongTrackTableEntrySize * numberOfTracks };
+	for (auto& track : yalpes.tracks)
+	{
+		priv_write(stream, track.events.size(), 8u);
+		priv_write(stream, offset, 8u);
+		priv_write(stream, track.isActivated() ? priv::yalpesSongActivatedFlag : 0u, 8u);
+		offset += priv_getTrackSize(track.events.size());
+	}
+
+	// events are written in (position, event index) order; the same order Yalpes uses for its event queue
+	std::vector<long long int> positions;
+	std::vector<std::size_t> order;
+	for (auto& track : yalpes.tracks)
+	{
+		const std::size_t numberOfEvents{ track.events.size() };
+		positions.resize(numberOfEvents);
+		order.resize(numberOfEvents);
+		for (std::size_t i{ 0u }; i < numberOfEvents; ++i)
+		{
+			positions[i] = FixedAbsorel(track.events[i].position).value;
+			order[i] = i;
+		}
+		if (!std::is_sorted(positions.begin(), positions.end()))
+			std::stable_sort(order.begin(), order.end(), [&positions](const std::size_t a, const std::size_t b) { return positions[a] < positions[b]; });
+
+		for (auto& index : order)
+			priv_write(stream, static_cast<unsigned long long int>(positions[index]), 8u);
+		for (auto& index : order)
+			priv_write(stream, track.events[index].type, 4u);
+		priv_writePadding(stream, priv_getPaddedSize(numberOfEvents * 4u) - numberOfEvents * 4u);
+		for (auto& index : order)
+			stream.write(reinterpret_cast<const char*>(&track.events[index].data), sizeof(TData));
+		priv_writePadding(stream, priv_getPaddedSize(numberOfEvents * sizeof(TData)) - numberOfEvents * sizeof(TData));
+	}
+	return static_cast<bool>(stream);
+}
+
+template <typename TData>
+inline bool YalpesSong<TData>::open(const std::string& filename)
+{
+	close();
+
+	// mapped arrays are read directly so the system must store values little-endian (as in the file)
+	const unsigned int one{ 1u };
+	if (*reinterpret_cast<const unsigned char*>(&one) != 1u)
+		return false;
+
+#ifdef _WIN32
+	const HANDLE file{ CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart <= 0))
+	{
+		CloseHandle(file);
+		return false;
+	}
+	const HANDLE mapping{ CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+	CloseHandle(file);
+	if (mapping == nullptr)
+		return false;
+	const void* view{ MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) };
+	CloseHandle(mapping); // (the view keeps the mapping open)
+	if (view == nullptr)
+		return false;
+	m_size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	const int file{ ::open(filename.c_str(), O_RDONLY) };
+	if (file < 0)
+		return false;
+	struct stat fileStatus;
+	if ((fstat(file, &fileStatus) != 0) || (fileStatus.st_size <= 0))
+	{
+		::close(file);
+		return false;
+	}
+	const void* view{ mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, file, 0) };
+	::close(file); // (the mapping keeps the file open)
+	if (view == MAP_FAILED)
+		return false;
+	m_size = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+	m_data = static_cast<const unsigned char*>(view);
+
+	// only the header and track table are validated; events are not read
+	bool isValid{ (m_size >= priv::yalpesSongHeaderSize) && (std::memcmp(m_data, priv::yalpesSongMagic, 4) == 0) && (m_data[4] == priv::yalpesSongVersion) && (priv_read(8u, 4u) == sizeof(TData)) };
+	const std::size_t numberOfTracks{ isValid ? static_cast<std::size_t>(priv_read(12u, 4u)) : 0u };
+	if (isValid && (numberOfTracks > (m_size - priv::yalpesSongHeaderSize) / priv::yalpesSongTrackTableEntrySize))
+		isValid = false;
+	for (std::size_t trackIndex{ 0u }; isValid && (trackIndex < numberOfTracks); ++trackIndex)
+	{
+		const unsigned long long int numberOfEvents{ priv_read(priv_getTrackTableOffset(trackIndex), 8u) };
+		const unsigned long long int offset{ priv_read(priv_getTrackTableOffset(trackIndex) + 8u, 8u) };
+		if (((offset % 8u) != 0u) || (offset > m_size) || (numberOfEvents > (m_size - offset) / 8u) || (priv_getTrackSize(static_cast<std::size_t>(numberOfEvents)) > m_size - offset))
+			isValid = false;
+	}
+	if (!isValid)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+template <typename TData>
+inline void YalpesSong<TData>::close()
+{
+	if (m_data == nullptr)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(m_data);
+#else
+	munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0u;
+}
+
+template <typename TData>
+inline bool YalpesSong<TData>::isOpen() const
+{
+	return m_data != nullptr;
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::getNumberOfTracks() const
+{
+	return isOpen() ? static_cast<std::size_t>(priv_read(12u, 4u)) : 0u;
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::getNumberOfEvents(const std::size_t trackIndex) const
+{
+	return static_cast<std::size_t>(priv_read(priv_getTrackTableOffset(trackIndex), 8u));
+}
+
+template <typename TData>
+inline bool YalpesSong<TData>::isTrackActivated(const std::size_t trackIndex) const
+{
+	return (priv_read(priv_getTrackTableOffset(trackIndex) + 16u, 8u) & priv::yalpesSongActivatedFlag) != 0u;
+}
+
+template <typename TData>
+inline const long long int* YalpesSong<TData>::getPositions(const std::size_t trackIndex) const
+{
+	return reinterpret_cast<const long long int*>(m_data + priv_getTrackOffset(trackIndex));
+}
+
+template <typename TData>
+inline const unsigned int* YalpesSong<TData>::getTypes(const std::size_t trackIndex) const
+{
+	return reinterpret_cast<const unsigned int*>(m_data + priv_getTrackOffset(trackIndex) + getNumberOfEvents(trackIndex) * 8u);
+}
+
+template <typename TData>
+inline const TData* YalpesSong<TData>::getData(const std::size_t trackIndex) const
+{
+	const std::size_t numberOfEvents{ getNumberOfEvents(trackIndex) };
+	return reinterpret_cast<const TData*>(m_data + priv_getTrackOffset(trackIndex) + numberOfEvents * 8u + priv_getPaddedSize(numberOfEvents * 4u));
+}
+
+template <typename TData>
+inline void YalpesSong<TData>::load(Yalpes<TData>& yalpes) const
+{
+	yalpes.stop();
+	const std::size_t numberOfTracks{ getNumberOfTracks() };
+	yalpes.tracks.clear();
+	yalpes.tracks.resize(numberOfTracks);
+	for (std::size_t trackIndex{ 0u }; trackIndex < numberOfTracks; ++trackIndex)
+	{
+		typename Yalpes<TData>::Track& track(yalpes.tracks[trackIndex]);
+		const std::size_t numberOfEvents{ getNumberOfEvents(trackIndex) };
+		const long long int* positions{ getPositions(trackIndex) };
+		const unsigned int* types{ getTypes(trackIndex) };
+		const TData* data{ getData(trackIndex) };
+		if (!isTrackActivated(trackIndex))
+		{
+			// deactivated tracks keep an empty queue so only their events are filled
+			track.deactivate();
+			track.events.reserve(numberOfEvents);
+			for (std::size_t i{ 0u }; i < numberOfEvents; ++i)
+				track.events.push_back(priv_getEvent(positions[i], types[i], data[i]));
+			continue;
+		}
+
+		// events are stored in order so they are filled once and used as the queue (no copy); only the keys and indices are built alongside them
+		track.events.reserve(numberOfEvents);
+		track.m_queueKeys.reserve(numberOfEvents);
+		track.m_eventIndices.reserve(numberOfEvents);
+		for (std::size_t i{ 0u }; i < numberOfEvents; ++i)
+		{
+			track.events.push_back(priv_getEvent(positions[i], types[i], data[i]));
+			track.m_queueKeys.push_back(Yalpes<TData>::sortKeyFromPosition(track.events.back().position));
+			track.m_eventIndices.push_back(i);
+		}
+		track.setQueueInEvents(true);
+	}
+	yalpes.updateLengthInSteps();
+	yalpes.placeCursors();
+}
+
+// PRIVATE
+
+template <typename TData>
+inline typename Yalpes<TData>::Event YalpesSong<TData>::priv_getEvent(const long long int position, const unsigned int type, const TData& data)
+{
+	typename Yalpes<TData>::Event event;
+	event.position = FixedAbsorel::fromValue(position).toAbsorel();
+	event.type = type;
+	event.data = data;
+	return event;
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::priv_getTrackTableOffset(const std::size_t trackIndex) const
+{
+	return priv::yalpesSongHeaderSize + priv::yalpesSongTrackTableEntrySize * trackIndex;
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::priv_getTrackOffset(const std::size_t trackIndex) const
+{
+	return static_cast<std::size_t>(priv_read(priv_getTrackTableOffset(trackIndex) + 8u, 8u));
+}
+
+template <typename TData>
+inline unsigned long long int YalpesSong<TData>::priv_read(const std::size_t offset, const unsigned int numberOfBytes) const
+{
+	unsigned long long int value{ 0u };
+	for (unsigned int i{ 0u }; i < numberOfBytes; ++i)
+		value |= static_cast<unsigned long long int>(m_data[offset + i]) << (i * 8u);
+	return value;
+}
+
+template <typename TData>
+inline void YalpesSong<TData>::priv_write(std::ostream& stream, const unsigned long long int value, const unsigned int numberOfBytes)
+{
+	char bytes[8];
+	for (unsigned int i{ 0u }; i < numberOfBytes; ++i)
+		bytes[i] = static_cast<char>(value >> (i * 8u));
+	stream.write(bytes, numberOfBytes);
+}
+
+template <typename TData>
+inline void YalpesSong<TData>::priv_writePadding(std::ostream& stream, std::size_t size)
+{
+	for (; size > 0u; --size)
+		stream.put('\0');
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::priv_getPaddedSize(const std::size_t size)
+{
+	return (size + 7u) & ~static_cast<std::size_t>(7u);
+}
+
+template <typename TData>
+inline std::size_t YalpesSong<TData>::priv_getTrackSize(const std::size_t numberOfEvents)
+{
+	return numberOfEvents * 8u + priv_getPaddedSize(numberOfEvents * 4u) + priv_getPaddedSize(numberOfEvents * sizeof(TData));
+}
+
+} // namespace kairos
+#endif // KAIROS_YALPESSONG_INL
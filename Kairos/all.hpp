@@ -34,13 +34,28 @@
 
 #include "Absorel.hpp"
 #include "BasicClock.hpp"
+#include "BasicTimestepLite.hpp"
+#include "ClockMapper.hpp"
 #include "Continuum.hpp"
+#include "DeterministicTimestep.hpp"
 #include "Duration.hpp"
+#include "FixedAbsorel.hpp"
 #include "FpsLite.hpp"
+#include "FrameLimiter.hpp"
+#include "FrameTimeTracker.hpp"
+#include "HitchDetector.hpp"
+#include "Interpolated.hpp"
+#include "InterpolationBuffer.hpp"
+#include "RollingFps.hpp"
+#include "SpscQueue.hpp"
 #include "Stopwatch.hpp"
+#include "TempoMap.hpp"
 #include "Timer.hpp"
 #include "Timestep.hpp"
+#include "TimestepBank.hpp"
 #include "TimestepLite.hpp"
+#include "TimestepLog.hpp"
 #include "Yalpes.hpp"
+#include "YalpesSequencer.hpp"
 
 #endif // KAIROS_ALL_HPP